@@ -0,0 +1,125 @@
+// AllocHooks.cpp
+// Replaces the global operator new/delete so every C++ heap allocation is
+// counted by AllocTracker. Only linked into binaries that opt in: the game
+// with -DFPS_TRACK_ALLOCATIONS=ON, and the tests that check allocation budgets.
+
+#include "AllocTracker.h"
+#include <cstdlib>
+#include <new>
+
+namespace {
+// marks the hook as installed during static initialization
+const bool hooked = (AllocTracker::Get().SetInstalled(AllocTracker::NEW), true);
+
+void* Allocate(std::size_t size) {
+    void* pointer = std::malloc(size ? size : 1);
+    if (pointer) {
+        AllocTracker::Get().RecordAllocation(AllocTracker::NEW, size);
+    }
+    return pointer;
+}
+
+void* AllocateAligned(std::size_t size, std::align_val_t alignment) {
+    std::size_t align = (std::size_t)alignment;
+    // aligned_alloc wants a whole number of alignments
+    std::size_t rounded = ((size ? size : 1) + align - 1) / align * align;
+    void* pointer = std::aligned_alloc(align, rounded);
+    if (pointer) {
+        AllocTracker::Get().RecordAllocation(AllocTracker::NEW, size);
+    }
+    return pointer;
+}
+
+void Free(void* pointer) {
+    if (pointer) {
+        AllocTracker::Get().RecordFree(AllocTracker::NEW);
+        std::free(pointer);
+    }
+}
+}
+
+void* operator new(std::size_t size) {
+    if (void* pointer = Allocate(size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return Allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return Allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    if (void* pointer = AllocateAligned(size, alignment)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return AllocateAligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return AllocateAligned(size, alignment);
+}
+
+void operator delete(void* pointer) noexcept {
+    Free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    Free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    Free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+    Free(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+    Free(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+    Free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept {
+    Free(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept {
+    Free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept {
+    Free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept {
+    Free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept {
+    Free(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept {
+    Free(pointer);
+}
@@ -0,0 +1,122 @@
+// AllocTracker.cpp
+
+#include "AllocTracker.h"
+#include "Profiler.h"
+
+static_assert(AllocTracker::maxSections == Profiler::maxSections, "one subsystem per profiler section");
+
+namespace {
+// constant-initialized, so the hooks can count allocations made before main
+constinit AllocTracker tracker;
+thread_local int currentSubsystem = AllocTracker::otherSubsystem;
+}
+
+AllocTracker& AllocTracker::Get() {
+    return tracker;
+}
+
+void AllocTracker::SetInstalled(Source source) {
+    installed.fetch_or(1 << source, std::memory_order_relaxed);
+}
+
+bool AllocTracker::IsInstalled() const {
+    return installed.load(std::memory_order_relaxed) != 0;
+}
+
+void AllocTracker::RecordAllocation(Source source, size_t bytes) {
+    Subsystem& subsystem = subsystems[currentSubsystem];
+    subsystem.frame.fetch_add(1, std::memory_order_relaxed);
+    subsystem.total.fetch_add(1, std::memory_order_relaxed);
+    subsystem.bytes.fetch_add((long long)bytes, std::memory_order_relaxed);
+    sourceTotals[source].fetch_add(1, std::memory_order_relaxed);
+    live.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AllocTracker::RecordFree(Source) {
+    live.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void AllocTracker::EndFrame() {
+    long long frameTotal = 0;
+    for (Subsystem& subsystem : subsystems) {
+        long long count = subsystem.frame.exchange(0, std::memory_order_relaxed);
+        subsystem.lastFrame = count;
+        if (count > subsystem.peakFrame) {
+            subsystem.peakFrame = count;
+        }
+        frameTotal += count;
+    }
+    lastFrameTotal = frameTotal;
+    frameCount++;
+}
+
+void AllocTracker::Reset() {
+    for (Subsystem& subsystem : subsystems) {
+        subsystem.frame.store(0, std::memory_order_relaxed);
+        subsystem.total.store(0, std::memory_order_relaxed);
+        subsystem.bytes.store(0, std::memory_order_relaxed);
+        subsystem.lastFrame = 0;
+        subsystem.peakFrame = 0;
+    }
+    for (std::atomic<long long>& total : sourceTotals) {
+        total.store(0, std::memory_order_relaxed);
+    }
+    lastFrameTotal = 0;
+    frameCount = 0;
+}
+
+long long AllocTracker::GetTotalAllocations() const {
+    long long total = 0;
+    for (const std::atomic<long long>& sourceTotal : sourceTotals) {
+        total += sourceTotal.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+long long AllocTracker::GetTotalAllocations(Source source) const {
+    return sourceTotals[source].load(std::memory_order_relaxed);
+}
+
+long long AllocTracker::GetTotalBytes() const {
+    long long total = 0;
+    for (const Subsystem& subsystem : subsystems) {
+        total += subsystem.bytes.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+long long AllocTracker::GetLiveAllocations() const {
+    return live.load(std::memory_order_relaxed);
+}
+
+long long AllocTracker::GetLastFrameAllocations() const {
+    return lastFrameTotal;
+}
+
+int AllocTracker::GetFrameCount() const {
+    return frameCount;
+}
+
+AllocTracker::SubsystemStats AllocTracker::GetStats(int subsystem) const {
+    SubsystemStats stats = {nullptr, 0, 0, 0, 0};
+    if (subsystem < 0 || subsystem >= subsystemCount) {
+        return stats;
+    }
+    const Subsystem& source = subsystems[subsystem];
+    stats.name = subsystem == otherSubsystem ? "other" : Profiler::Get().GetSectionName(subsystem);
+    stats.lastFrame = source.lastFrame;
+    stats.peakFrame = source.peakFrame;
+    stats.total = source.total.load(std::memory_order_relaxed);
+    stats.totalBytes = source.bytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+int AllocTracker::EnterSubsystem(int subsystem) {
+    int previous = currentSubsystem;
+    currentSubsystem = subsystem >= 0 && subsystem < otherSubsystem ? subsystem : otherSubsystem;
+    return previous;
+}
+
+void AllocTracker::LeaveSubsystem(int previous) {
+    currentSubsystem = previous;
+}
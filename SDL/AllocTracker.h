@@ -0,0 +1,75 @@
+// AllocTracker.h
+#ifndef ALLOC_TRACKER_H
+#define ALLOC_TRACKER_H
+
+#include <atomic>
+#include <cstddef>
+
+// Counts heap allocations per frame, split by subsystem. A subsystem is the
+// innermost PROFILE_SCOPE section open on the allocating thread; allocations
+// outside every scope (or with the profiler compiled out) land in "other".
+// Nothing is counted unless hooks are linked in: AllocHooks.cpp replaces the
+// global operator new/delete and InstallSdlAllocHooks routes SDL_malloc here.
+// The game gets both with -DFPS_TRACK_ALLOCATIONS=ON; tests compile
+// AllocHooks.cpp in directly. Recording is lock-free and may come from any
+// thread; EndFrame and the stats are meant for the main thread.
+class AllocTracker {
+    public:
+        static constexpr int maxSections = 32; // Profiler::maxSections, checked in AllocTracker.cpp
+        static constexpr int otherSubsystem = maxSections;
+        static constexpr int subsystemCount = maxSections + 1;
+
+        enum Source {
+            NEW,        // global operator new
+            SDL_MALLOC, // SDL_malloc and friends
+            sourceCount
+        };
+
+        struct SubsystemStats {
+            const char* name;
+            long long lastFrame;   // allocations in the last finished frame
+            long long peakFrame;   // most in any one frame since Reset
+            long long total;       // since Reset, open frame included
+            long long totalBytes;
+        };
+
+        static AllocTracker& Get();
+
+        void SetInstalled(Source source); // called by the hooks
+        bool IsInstalled() const;         // any hook is counting
+
+        void RecordAllocation(Source source, size_t bytes);
+        void RecordFree(Source source);
+        void EndFrame();
+        void Reset();
+
+        long long GetTotalAllocations() const;          // every source and subsystem since Reset
+        long long GetTotalAllocations(Source source) const;
+        long long GetTotalBytes() const;                // every source and subsystem since Reset
+        long long GetLiveAllocations() const;           // allocations not yet freed, over the process
+        long long GetLastFrameAllocations() const;      // every subsystem, last finished frame
+        int GetFrameCount() const;                      // frames ended since Reset
+        SubsystemStats GetStats(int subsystem) const;   // Profiler section id, or otherSubsystem
+
+        // Subsystem for the calling thread's allocations; returns the one it replaces
+        static int EnterSubsystem(int subsystem);
+        static void LeaveSubsystem(int previous);
+
+    private:
+        struct Subsystem {
+            std::atomic<long long> frame{0};
+            std::atomic<long long> total{0};
+            std::atomic<long long> bytes{0};
+            long long lastFrame = 0;
+            long long peakFrame = 0;
+        };
+
+        Subsystem subsystems[subsystemCount];
+        std::atomic<long long> sourceTotals[sourceCount] = {};
+        std::atomic<long long> live{0};
+        std::atomic<int> installed{0};
+        long long lastFrameTotal = 0;
+        int frameCount = 0;
+};
+
+#endif // ALLOC_TRACKER_H
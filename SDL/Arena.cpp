@@ -0,0 +1,96 @@
+// Arena.cpp
+
+#include "Arena.h"
+#include <cstdint>
+
+Arena::Arena(size_t blockSize) : blockSize(blockSize) {
+    offset = 0;
+    used = 0;
+    needed = 0;
+    heapAllocations = 0;
+}
+
+Arena::~Arena() {
+    FreeBlocks();
+}
+
+void* Arena::Allocate(size_t bytes, size_t alignment) {
+    if (alignment < minAlignment) {
+        alignment = minAlignment;
+    }
+    // worst case for this request in one contiguous block that stays minAlignment aligned
+    needed += ((bytes + minAlignment - 1) & ~(minAlignment - 1)) + alignment - minAlignment;
+    if (!blocks.empty()) {
+        if (void* pointer = Bump(bytes, alignment)) {
+            return pointer;
+        }
+    }
+    AddBlock(bytes + alignment);
+    return Bump(bytes, alignment);
+}
+
+void Arena::Reset() {
+    if (blocks.size() > 1) {
+        // one block that holds everything the last cycle needed
+        FreeBlocks();
+        AddBlock(needed);
+    }
+    offset = 0;
+    used = 0;
+    needed = 0;
+}
+
+void Arena::Reserve(size_t bytes) {
+    if (!blocks.empty() && offset + bytes <= blocks.back().size) {
+        return;
+    }
+    AddBlock(bytes);
+}
+
+size_t Arena::GetUsedBytes() const {
+    return used;
+}
+
+size_t Arena::GetCapacity() const {
+    size_t capacity = 0;
+    for (const Block& block : blocks) {
+        capacity += block.size;
+    }
+    return capacity;
+}
+
+int Arena::GetBlockCount() const {
+    return (int)blocks.size();
+}
+
+long long Arena::GetHeapAllocationCount() const {
+    return heapAllocations;
+}
+
+void* Arena::Bump(size_t bytes, size_t alignment) {
+    Block& block = blocks.back();
+    std::uintptr_t base = reinterpret_cast<std::uintptr_t>(block.data);
+    size_t start = ((base + offset + alignment - 1) & ~(std::uintptr_t)(alignment - 1)) - base;
+    if (start + bytes > block.size) {
+        return nullptr;
+    }
+    used += start + bytes - offset;
+    offset = start + bytes;
+    return block.data + start;
+}
+
+void Arena::AddBlock(size_t minimumSize) {
+    size_t size = minimumSize > blockSize ? minimumSize : blockSize;
+    size = (size + minAlignment - 1) & ~(minAlignment - 1);
+    char* data = static_cast<char*>(::operator new(size, std::align_val_t(minAlignment)));
+    blocks.push_back(Block{data, size});
+    heapAllocations++;
+    offset = 0;
+}
+
+void Arena::FreeBlocks() {
+    for (const Block& block : blocks) {
+        ::operator delete(block.data, std::align_val_t(minAlignment));
+    }
+    blocks.clear();
+}
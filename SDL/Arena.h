@@ -0,0 +1,108 @@
+// Arena.h
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Bump allocator: Allocate hands out the next free bytes of the current
+// block and nothing is freed until Reset, which makes every byte reusable
+// at once. A request that doesn't fit opens a new block from the heap;
+// Reset then swaps the blocks for a single one big enough for everything
+// handed out since the last Reset, so a steady workload stops touching the
+// heap after its first cycle. One thread at a time.
+class Arena {
+    public:
+        explicit Arena(size_t blockSize = 64 * 1024);
+        ~Arena();
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        void* Allocate(size_t bytes, size_t alignment);
+        void Reset(); // everything handed out so far becomes invalid
+        void Reserve(size_t bytes); // the next bytes of requests fit without a new block
+
+        size_t GetUsedBytes() const;     // handed out since the last Reset, padding included
+        size_t GetCapacity() const;      // bytes in all blocks
+        int GetBlockCount() const;
+        long long GetHeapAllocationCount() const; // blocks taken from the heap over the arena's life
+
+    private:
+        static constexpr size_t minAlignment = 16;
+
+        struct Block {
+            char* data;
+            size_t size;
+        };
+
+        std::vector<Block> blocks; // the last one is being filled
+        size_t blockSize;
+        size_t offset;             // next free byte in the last block
+        size_t used;               // bytes handed out before the last block, plus offset
+        size_t needed;             // a single block this big would have held everything since the last Reset
+        long long heapAllocations;
+
+        void* Bump(size_t bytes, size_t alignment); // null when the last block is full
+        void AddBlock(size_t minimumSize);
+        void FreeBlocks();
+};
+
+// std allocator over an Arena. deallocate is a no-op; the memory comes
+// back when the arena is Reset. With no arena it uses the heap, so a
+// container that was never given an arena behaves like the plain one.
+// Copies of a container go to the heap rather than sharing the source's
+// arena, so snapshots and test copies outlive a level reset.
+template <typename T>
+class ArenaAllocator {
+    public:
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        ArenaAllocator() noexcept : arena(nullptr) {}
+        explicit ArenaAllocator(Arena* arena) noexcept : arena(arena) {}
+        template <typename U>
+        ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.GetArena()) {}
+
+        T* allocate(size_t count) {
+            if (!arena) {
+                return static_cast<T*>(::operator new(count * sizeof(T)));
+            }
+            return static_cast<T*>(arena->Allocate(count * sizeof(T), alignof(T)));
+        }
+        void deallocate(T* pointer, size_t) noexcept {
+            if (!arena) {
+                ::operator delete(pointer);
+            }
+        }
+
+        ArenaAllocator select_on_container_copy_construction() const { return ArenaAllocator(); }
+        Arena* GetArena() const { return arena; }
+
+        template <typename U>
+        bool operator==(const ArenaAllocator<U>& other) const { return arena == other.GetArena(); }
+        template <typename U>
+        bool operator!=(const ArenaAllocator<U>& other) const { return arena != other.GetArena(); }
+
+    private:
+        Arena* arena;
+};
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+// Moves vector's contents into storage from arena (null for the heap) with
+// room for at least capacity elements. The old storage is left to its arena.
+template <typename T>
+void RebindArena(ArenaVector<T>& vector, Arena* arena, size_t capacity) {
+    ArenaVector<T> moved{ArenaAllocator<T>(arena)};
+    moved.reserve(capacity > vector.size() ? capacity : vector.size());
+    moved.insert(moved.end(), vector.begin(), vector.end());
+    vector = std::move(moved);
+}
+
+#endif // ARENA_H
@@ -0,0 +1,214 @@
+// AssetManager.cpp
+
+#include <cstdio>
+#include <filesystem>
+#include "AssetManager.h"
+#include <SDL2/SDL_image.h>
+
+AssetManager::AssetManager() {
+    ttfStarted = false;
+}
+
+AssetManager::~AssetManager() {
+    Shutdown();
+}
+
+// ====== Root ======
+
+bool AssetManager::ResolveRoot(const char* probeFile) {
+    std::vector<std::string> candidates = {"", "SDL/", "../", "../SDL/", "../../SDL/"};
+    char* basePathRaw = SDL_GetBasePath();
+    if (basePathRaw) {
+        std::string basePath(basePathRaw);
+        SDL_free(basePathRaw);
+        candidates.push_back(basePath);
+        candidates.push_back(basePath + "../");
+        candidates.push_back(basePath + "../SDL/");
+    }
+
+    std::string found;
+    if (!FindRoot(candidates, probeFile, found)) {
+        printf("Could not find the assets (looked for %s in %zu places)\n", probeFile, candidates.size());
+        return false;
+    }
+    SetRoot(found);
+    return true;
+}
+
+void AssetManager::ResolveRootOnMiss(const char* probeFile) {
+    rootProbe = probeFile;
+}
+
+void AssetManager::SetRoot(const std::string& root) {
+    rootProbe.clear();
+    this->root = root;
+    if (!this->root.empty() && this->root.back() != '/') {
+        this->root += '/';
+    }
+}
+
+bool AssetManager::OpenPack(const char* fileName) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    bool opened = pack.Open(fileName);
+    if (!opened) {
+        char* basePathRaw = SDL_GetBasePath();
+        if (basePathRaw) {
+            std::string path = std::string(basePathRaw) + fileName;
+            SDL_free(basePathRaw);
+            opened = pack.Open(path.c_str());
+        }
+    }
+    Record(fileName, start, opened, false);
+    return opened;
+}
+
+const AssetPack& AssetManager::GetPack() const {
+    return pack;
+}
+
+const std::string& AssetManager::GetRoot() const {
+    return root;
+}
+
+std::string AssetManager::Resolve(const char* relativePath) const {
+    return root + relativePath;
+}
+
+std::string AssetManager::ResolveLoose(const char* relativePath) {
+    if (!rootProbe.empty()) {
+        std::string probe;
+        probe.swap(rootProbe);
+        ResolveRoot(probe.c_str());
+    }
+    return Resolve(relativePath);
+}
+
+bool AssetManager::FindRoot(const std::vector<std::string>& candidates, const char* probeFile, std::string& root) {
+    for (const std::string& candidate : candidates) {
+        std::error_code error;
+        if (std::filesystem::is_regular_file(candidate + probeFile, error)) {
+            root = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string AssetManager::FontKey(const char* relativePath, int pointSize) {
+    return std::string(relativePath) + "@" + std::to_string(pointSize);
+}
+
+// ====== Loading ======
+
+SDL_Surface* AssetManager::LoadSurface(const char* relativePath) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    const AssetPack::Entry* entry = pack.Find(relativePath);
+    if (entry && entry->format == AssetPack::RGBA32) {
+        // Points straight at the mapping: no decode, no copy
+        SDL_Surface* borrowed = SDL_CreateRGBSurfaceWithFormatFrom(const_cast<unsigned char*>(entry->data), entry->width,
+                                                                   entry->height, 32, entry->width * 4,
+                                                                   SDL_PIXELFORMAT_RGBA32);
+        Record(relativePath, start, borrowed != nullptr, true);
+        return borrowed;
+    }
+
+    std::string path = entry ? relativePath : ResolveLoose(relativePath);
+    SDL_Surface* converted = nullptr;
+    SDL_Surface* loaded = entry ? IMG_Load_RW(SDL_RWFromConstMem(entry->data, (int)entry->size), 1)
+                                : IMG_Load(path.c_str());
+    if (loaded) {
+        converted = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+        SDL_FreeSurface(loaded);
+    } else {
+        printf("Could not load %s: %s\n", path.c_str(), IMG_GetError());
+    }
+    Record(relativePath, start, converted != nullptr, entry != nullptr);
+    return converted;
+}
+
+TTF_Font* AssetManager::AcquireFont(const char* relativePath, int pointSize) {
+    std::string key = FontKey(relativePath, pointSize);
+    for (CachedFont& cached : fonts) {
+        if (cached.key == key) {
+            cached.references++;
+            return cached.font;
+        }
+    }
+
+    if (!ttfStarted) {
+        if (TTF_Init() == -1) {
+            printf("TTF_Init Error: %s\n", TTF_GetError());
+            return nullptr;
+        }
+        ttfStarted = true;
+    }
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    // A packed font is read from the mapping for as long as it's open
+    const AssetPack::Entry* entry = pack.Find(relativePath);
+    TTF_Font* font = entry ? TTF_OpenFontRW(SDL_RWFromConstMem(entry->data, (int)entry->size), 1, pointSize)
+                           : TTF_OpenFont(ResolveLoose(relativePath).c_str(), pointSize);
+    Record(key, start, font != nullptr, entry != nullptr);
+    if (!font) {
+        printf("TTF_OpenFont Error: %s\n", TTF_GetError());
+        return nullptr;
+    }
+    fonts.push_back(CachedFont{key, font, 1});
+    return font;
+}
+
+void AssetManager::ReleaseFont(TTF_Font* font) {
+    for (size_t i = 0; i < fonts.size(); i++) {
+        if (fonts[i].font != font) {
+            continue;
+        }
+        if (--fonts[i].references == 0) {
+            TTF_CloseFont(font);
+            fonts.erase(fonts.begin() + i);
+        }
+        return;
+    }
+}
+
+int AssetManager::GetFontCount() const {
+    return (int)fonts.size();
+}
+
+void AssetManager::Shutdown() {
+    for (CachedFont& cached : fonts) {
+        TTF_CloseFont(cached.font);
+    }
+    fonts.clear();
+    if (ttfStarted) {
+        TTF_Quit();
+        ttfStarted = false;
+    }
+    pack.Close(); // after the fonts, which read from it
+}
+
+// ====== Timings ======
+
+void AssetManager::Record(const std::string& key, std::chrono::steady_clock::time_point start, bool loaded, bool packed) {
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    records.push_back(LoadRecord{key, elapsed.count(), loaded, packed});
+}
+
+const std::vector<AssetManager::LoadRecord>& AssetManager::GetLoadRecords() const {
+    return records;
+}
+
+double AssetManager::GetTotalLoadMilliseconds() const {
+    double total = 0.0;
+    for (const LoadRecord& record : records) {
+        total += record.milliseconds;
+    }
+    return total;
+}
+
+void AssetManager::PrintLoadTimings() const {
+    printf("Loaded %zu assets from '%s'%s in %.2f ms\n", records.size(), root.c_str(),
+           pack.IsOpen() ? " and the asset pack" : "", GetTotalLoadMilliseconds());
+    for (const LoadRecord& record : records) {
+        printf("  %8.3f ms  %s%s%s\n", record.milliseconds, record.key.c_str(), record.packed ? " (packed)" : "",
+               record.loaded ? "" : " (missing)");
+    }
+}
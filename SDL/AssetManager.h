@@ -0,0 +1,83 @@
+// AssetManager.h
+#ifndef ASSET_MANAGER_H
+#define ASSET_MANAGER_H
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include "AssetPack.h"
+
+// Finds the asset root once and opens every sprite and font relative to it,
+// so each asset costs one file open instead of a walk over fallback paths.
+// Fonts are cached by file and point size and shared between everyone who
+// acquires them; the last ReleaseFont closes one. Sprite images come back as
+// surfaces for the atlas to pack and aren't kept. Every load is timed.
+// With a pack open, assets it holds are read from the mapping and only the
+// ones it lacks fall back to loose files under the root.
+class AssetManager {
+    public:
+        struct LoadRecord {
+            std::string key;   // relative path, plus "@size" for fonts
+            double milliseconds;
+            bool loaded;
+            bool packed; // came out of the asset pack
+        };
+
+        AssetManager();
+        ~AssetManager();
+        AssetManager(const AssetManager&) = delete;
+        AssetManager& operator=(const AssetManager&) = delete;
+
+        // Picks the first candidate directory holding probeFile (relative to it):
+        // the working directory, the source tree's SDL/ folder from the usual
+        // build directories, then the same next to the executable.
+        bool ResolveRoot(const char* probeFile); // false leaves the root as it was
+        // Same search, but only the first time an asset has to come from a loose
+        // file, so a complete pack never looks at the disk beyond itself
+        void ResolveRootOnMiss(const char* probeFile);
+        void SetRoot(const std::string& root); // skips the search, pending or not
+        const std::string& GetRoot() const;
+        std::string Resolve(const char* relativePath) const;
+
+        // Maps fileName from the working directory, else from next to the executable
+        bool OpenPack(const char* fileName);
+        const AssetPack& GetPack() const;
+
+        // RGBA32, caller frees; null if missing. A pre-decoded packed sprite
+        // borrows the pack's read-only pixels, so free it before Shutdown.
+        SDL_Surface* LoadSurface(const char* relativePath);
+        TTF_Font* AcquireFont(const char* relativePath, int pointSize); // null if it can't be opened
+        void ReleaseFont(TTF_Font* font);
+        int GetFontCount() const; // fonts open right now
+
+        void Shutdown(); // closes whatever fonts are left, SDL_ttf and the pack
+
+        const std::vector<LoadRecord>& GetLoadRecords() const;
+        double GetTotalLoadMilliseconds() const;
+        void PrintLoadTimings() const;
+
+        // Sets root to the first candidate with probeFile inside it; false for none
+        static bool FindRoot(const std::vector<std::string>& candidates, const char* probeFile, std::string& root);
+        static std::string FontKey(const char* relativePath, int pointSize);
+
+    private:
+        struct CachedFont {
+            std::string key;
+            TTF_Font* font;
+            int references;
+        };
+
+        std::string root;
+        std::string rootProbe; // set while ResolveRootOnMiss hasn't searched yet
+        bool ttfStarted;
+        std::vector<CachedFont> fonts;
+        std::vector<LoadRecord> records;
+        AssetPack pack;
+
+        std::string ResolveLoose(const char* relativePath); // runs a pending root search first
+        void Record(const std::string& key, std::chrono::steady_clock::time_point start, bool loaded, bool packed);
+};
+
+#endif // ASSET_MANAGER_H
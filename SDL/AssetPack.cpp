@@ -0,0 +1,233 @@
+// AssetPack.cpp
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include "AssetPack.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+const char magic[4] = {'F', 'P', 'S', 'A'};
+const std::uint32_t formatVersion = 1;
+
+void PutU32(std::vector<unsigned char>& out, std::uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        out.push_back((unsigned char)(value >> (8 * i)));
+    }
+}
+
+void PutU64(std::vector<unsigned char>& out, std::uint64_t value) {
+    PutU32(out, (std::uint32_t)value);
+    PutU32(out, (std::uint32_t)(value >> 32));
+}
+
+struct Reader {
+    const unsigned char* data;
+    size_t size;
+    size_t position;
+    bool ok;
+
+    bool Has(size_t count) {
+        ok = ok && count <= size - position;
+        return ok;
+    }
+
+    std::uint32_t U32() {
+        if (!Has(4)) {
+            return 0;
+        }
+        std::uint32_t value = 0;
+        for (int i = 0; i < 4; i++) {
+            value |= (std::uint32_t)data[position++] << (8 * i);
+        }
+        return value;
+    }
+
+    std::uint64_t U64() {
+        std::uint64_t low = U32();
+        return low | ((std::uint64_t)U32() << 32);
+    }
+};
+
+size_t AlignUp(size_t value) {
+    return (value + AssetPack::dataAlignment - 1) / AssetPack::dataAlignment * AssetPack::dataAlignment;
+}
+}
+
+AssetPack::AssetPack() {
+    bytes = nullptr;
+    byteCount = 0;
+    mapped = false;
+}
+
+AssetPack::~AssetPack() {
+    Close();
+}
+
+// ====== Writing ======
+
+bool AssetPack::Write(const char* path, std::vector<Source> sources) {
+    std::sort(sources.begin(), sources.end(), [](const Source& a, const Source& b) { return a.name < b.name; });
+
+    size_t indexEnd = 12;
+    for (const Source& source : sources) {
+        indexEnd += 4 + source.name.size() + 12 + 16;
+    }
+    std::vector<unsigned char> data;
+    data.insert(data.end(), magic, magic + 4);
+    PutU32(data, formatVersion);
+    PutU32(data, (std::uint32_t)sources.size());
+    size_t offset = AlignUp(indexEnd);
+    for (const Source& source : sources) {
+        PutU32(data, (std::uint32_t)source.name.size());
+        data.insert(data.end(), source.name.begin(), source.name.end());
+        PutU32(data, source.format);
+        PutU32(data, (std::uint32_t)source.width);
+        PutU32(data, (std::uint32_t)source.height);
+        PutU64(data, offset);
+        PutU64(data, source.bytes.size());
+        offset = AlignUp(offset + source.bytes.size());
+    }
+    for (const Source& source : sources) {
+        data.resize(AlignUp(data.size()), 0);
+        data.insert(data.end(), source.bytes.begin(), source.bytes.end());
+    }
+
+    FILE* file = std::fopen(path, "wb");
+    if (!file) {
+        return false;
+    }
+    bool written = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+    std::fclose(file);
+    return written;
+}
+
+// ====== Reading ======
+
+bool AssetPack::Open(const char* path) {
+    Close();
+#ifndef _WIN32
+    int file = ::open(path, O_RDONLY);
+    if (file < 0) {
+        return false;
+    }
+    struct stat info;
+    if (::fstat(file, &info) != 0 || info.st_size <= 0) {
+        ::close(file);
+        return false;
+    }
+    void* mapping = ::mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    ::close(file); // the mapping keeps the pages reachable
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+    bytes = static_cast<const unsigned char*>(mapping);
+    byteCount = (size_t)info.st_size;
+    mapped = true;
+#else
+    FILE* file = std::fopen(path, "rb");
+    if (!file) {
+        return false;
+    }
+    unsigned char buffer[4096];
+    size_t count;
+    while ((count = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        fallback.insert(fallback.end(), buffer, buffer + count);
+    }
+    std::fclose(file);
+    bytes = fallback.data();
+    byteCount = fallback.size();
+#endif
+
+    if (!ReadIndex()) {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+bool AssetPack::ReadIndex() {
+    Reader reader = {bytes, byteCount, 0, true};
+    if (!reader.Has(4) || std::memcmp(bytes, magic, 4) != 0) {
+        return false;
+    }
+    reader.position = 4;
+    if (reader.U32() != formatVersion) {
+        return false;
+    }
+    std::uint32_t entryCount = reader.U32();
+    for (std::uint32_t i = 0; i < entryCount && reader.ok; i++) {
+        std::uint32_t nameLength = reader.U32();
+        if (!reader.Has(nameLength)) {
+            break;
+        }
+        Entry entry;
+        entry.name.assign(reinterpret_cast<const char*>(bytes + reader.position), nameLength);
+        reader.position += nameLength;
+        std::uint32_t format = reader.U32();
+        entry.width = (int)reader.U32();
+        entry.height = (int)reader.U32();
+        std::uint64_t offset = reader.U64();
+        std::uint64_t size = reader.U64();
+        bool inFile = offset <= byteCount && size <= byteCount - offset;
+        bool pixelsFit = format != RGBA32 || (std::uint64_t)entry.width * entry.height * 4 == size;
+        if (!reader.ok || format > RGBA32 || !inFile || !pixelsFit) {
+            return false;
+        }
+        entry.format = (Format)format;
+        entry.data = bytes + offset;
+        entry.size = (size_t)size;
+        entries.push_back(entry);
+    }
+    if (!reader.ok) {
+        return false;
+    }
+    // Find binary searches, so don't trust the writer's order
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.name < b.name; });
+    return true;
+}
+
+void AssetPack::Close() {
+#ifndef _WIN32
+    if (mapped) {
+        ::munmap(const_cast<unsigned char*>(bytes), byteCount);
+    }
+#endif
+    bytes = nullptr;
+    byteCount = 0;
+    mapped = false;
+    fallback.clear();
+    fallback.shrink_to_fit();
+    entries.clear();
+}
+
+bool AssetPack::IsOpen() const {
+    return bytes != nullptr;
+}
+
+bool AssetPack::IsMapped() const {
+    return mapped;
+}
+
+const AssetPack::Entry* AssetPack::Find(const char* name) const {
+    auto found = std::lower_bound(entries.begin(), entries.end(), name,
+                                  [](const Entry& entry, const char* key) { return entry.name < key; });
+    if (found == entries.end() || found->name != name) {
+        return nullptr;
+    }
+    return &*found;
+}
+
+int AssetPack::GetEntryCount() const {
+    return (int)entries.size();
+}
+
+const AssetPack::Entry& AssetPack::GetEntry(int index) const {
+    return entries[index];
+}
@@ -0,0 +1,67 @@
+// AssetPack.h
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// One file holding every sprite and font, built by tools/asset_packer. Layout
+// (little-endian): "FPSA", version, entry count, then an index of
+// {name, format, width, height, offset, size} and the entry bytes, each
+// starting 16-byte aligned. Open maps the file read-only, so entries are read
+// in place and opening the pack is the only file open at startup.
+class AssetPack {
+    public:
+        enum Format : std::uint32_t {
+            RAW = 0,   // the file as it was, e.g. PNG or TTF
+            RGBA32 = 1 // decoded pixels, width * 4 bytes per row
+        };
+
+        struct Entry {
+            std::string name; // path relative to the asset root, as AssetManager asks for it
+            Format format;
+            int width;  // RGBA32 only
+            int height;
+            const unsigned char* data; // inside the mapping, valid until Close
+            size_t size;
+        };
+
+        struct Source {
+            std::string name;
+            Format format = RAW;
+            int width = 0;
+            int height = 0;
+            std::vector<unsigned char> bytes;
+        };
+
+        static constexpr size_t dataAlignment = 16;
+
+        AssetPack();
+        ~AssetPack();
+        AssetPack(const AssetPack&) = delete;
+        AssetPack& operator=(const AssetPack&) = delete;
+
+        static bool Write(const char* path, std::vector<Source> sources); // entries are sorted by name
+
+        bool Open(const char* path); // false (and closed) on a missing or malformed file
+        void Close();
+        bool IsOpen() const;
+        bool IsMapped() const; // false when the platform has no mmap and the file was read in
+
+        const Entry* Find(const char* name) const; // null when the pack doesn't have it
+        int GetEntryCount() const;
+        const Entry& GetEntry(int index) const;
+
+    private:
+        const unsigned char* bytes;
+        size_t byteCount;
+        bool mapped;
+        std::vector<unsigned char> fallback; // the whole file, without mmap
+        std::vector<Entry> entries;          // sorted by name
+
+        bool ReadIndex();
+};
+
+#endif // ASSET_PACK_H
@@ -0,0 +1,196 @@
+// BulletPool.cpp
+
+#include "BulletPool.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+void BulletPool::Add(float newX, float newY, float newDX, float newDY, float newSpeed, int newDamage) {
+    x.push_back(newX);
+    y.push_back(newY);
+    prevX.push_back(newX);
+    prevY.push_back(newY);
+    dx.push_back(newDX);
+    dy.push_back(newDY);
+    speed.push_back(newSpeed);
+    damage.push_back(newDamage);
+    alive.push_back(1);
+}
+
+void BulletPool::Add(const Bullet& bullet) {
+    Add(bullet.x, bullet.y, bullet.dx, bullet.dy, bullet.speed, bullet.damage);
+    prevX.back() = bullet.prevX;
+    prevY.back() = bullet.prevY;
+    if (bullet.toDelete) {
+        Kill(Size() - 1);
+    }
+}
+
+Bullet BulletPool::Get(int index) const {
+    Bullet bullet{x[index], y[index], dx[index], dy[index], speed[index], damage[index]};
+    bullet.toDelete = !alive[index];
+    bullet.prevX = prevX[index];
+    bullet.prevY = prevY[index];
+    return bullet;
+}
+
+int BulletPool::Size() const {
+    return (int)x.size();
+}
+
+bool BulletPool::Empty() const {
+    return x.empty();
+}
+
+void BulletPool::Clear() {
+    x.clear();
+    y.clear();
+    prevX.clear();
+    prevY.clear();
+    dx.clear();
+    dy.clear();
+    speed.clear();
+    damage.clear();
+    alive.clear();
+    deadCount = 0;
+}
+
+void BulletPool::Reserve(int count) {
+    x.reserve(count);
+    y.reserve(count);
+    prevX.reserve(count);
+    prevY.reserve(count);
+    dx.reserve(count);
+    dy.reserve(count);
+    speed.reserve(count);
+    damage.reserve(count);
+    alive.reserve(count);
+}
+
+int BulletPool::Capacity() const {
+    return (int)x.capacity();
+}
+
+void BulletPool::UseArena(Arena* arena, int capacity) {
+    RebindArena(x, arena, capacity);
+    RebindArena(y, arena, capacity);
+    RebindArena(prevX, arena, capacity);
+    RebindArena(prevY, arena, capacity);
+    RebindArena(dx, arena, capacity);
+    RebindArena(dy, arena, capacity);
+    RebindArena(speed, arena, capacity);
+    RebindArena(damage, arena, capacity);
+    RebindArena(alive, arena, capacity);
+}
+
+void BulletPool::Integrate(float deltaTime) {
+    BulletKernels::Integrate(x.data(), y.data(), prevX.data(), prevY.data(),
+                             dx.data(), dy.data(), speed.data(), Size(), deltaTime);
+}
+
+void BulletPool::Kill(int index) {
+    if (alive[index]) {
+        alive[index] = 0;
+        deadCount++;
+    }
+}
+
+bool BulletPool::IsAlive(int index) const {
+    return alive[index] != 0;
+}
+
+void BulletPool::RemoveDead() {
+    int i = 0;
+    while (deadCount > 0 && i < Size()) {
+        if (alive[i]) {
+            i++;
+            continue;
+        }
+        // the bullet swapped in is checked on the next pass at the same index
+        int last = Size() - 1;
+        if (!alive[last]) {
+            deadCount--;
+            PopBack();
+            continue;
+        }
+        MoveBullet(last, i);
+        deadCount--;
+        PopBack();
+    }
+}
+
+void BulletPool::MoveBullet(int from, int to) {
+    x[to] = x[from];
+    y[to] = y[from];
+    prevX[to] = prevX[from];
+    prevY[to] = prevY[from];
+    dx[to] = dx[from];
+    dy[to] = dy[from];
+    speed[to] = speed[from];
+    damage[to] = damage[from];
+    alive[to] = alive[from];
+}
+
+void BulletPool::PopBack() {
+    x.pop_back();
+    y.pop_back();
+    prevX.pop_back();
+    prevY.pop_back();
+    dx.pop_back();
+    dy.pop_back();
+    speed.pop_back();
+    damage.pop_back();
+    alive.pop_back();
+}
+
+// ====== Kernels ======
+
+namespace BulletKernels {
+
+void IntegrateScalar(float* x, float* y, float* prevX, float* prevY,
+                     const float* dx, const float* dy, const float* speed,
+                     int count, float deltaTime) {
+    for (int i = 0; i < count; i++) {
+        float step = speed[i] * deltaTime;
+        prevX[i] = x[i];
+        prevY[i] = y[i];
+        x[i] += dx[i] * step;
+        y[i] += dy[i] * step;
+    }
+}
+
+void Integrate(float* x, float* y, float* prevX, float* prevY,
+               const float* dx, const float* dy, const float* speed,
+               int count, float deltaTime) {
+    int i = 0;
+#if defined(__AVX2__)
+    const __m256 dt8 = _mm256_set1_ps(deltaTime);
+    for (; i + 8 <= count; i += 8) {
+        __m256 step = _mm256_mul_ps(_mm256_loadu_ps(speed + i), dt8);
+        __m256 px = _mm256_loadu_ps(x + i);
+        __m256 py = _mm256_loadu_ps(y + i);
+        _mm256_storeu_ps(prevX + i, px);
+        _mm256_storeu_ps(prevY + i, py);
+        _mm256_storeu_ps(x + i, _mm256_add_ps(px, _mm256_mul_ps(_mm256_loadu_ps(dx + i), step)));
+        _mm256_storeu_ps(y + i, _mm256_add_ps(py, _mm256_mul_ps(_mm256_loadu_ps(dy + i), step)));
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    const __m128 dt4 = _mm_set1_ps(deltaTime);
+    for (; i + 4 <= count; i += 4) {
+        __m128 step = _mm_mul_ps(_mm_loadu_ps(speed + i), dt4);
+        __m128 px = _mm_loadu_ps(x + i);
+        __m128 py = _mm_loadu_ps(y + i);
+        _mm_storeu_ps(prevX + i, px);
+        _mm_storeu_ps(prevY + i, py);
+        _mm_storeu_ps(x + i, _mm_add_ps(px, _mm_mul_ps(_mm_loadu_ps(dx + i), step)));
+        _mm_storeu_ps(y + i, _mm_add_ps(py, _mm_mul_ps(_mm_loadu_ps(dy + i), step)));
+    }
+#endif
+    // remainder, or everything on targets without a SIMD path
+    IntegrateScalar(x + i, y + i, prevX + i, prevY + i, dx + i, dy + i, speed + i, count - i, deltaTime);
+}
+
+}
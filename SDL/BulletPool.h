@@ -0,0 +1,72 @@
+// BulletPool.h
+#ifndef BULLET_POOL_H
+#define BULLET_POOL_H
+
+#include <cstdint>
+#include <vector>
+#include "Arena.h"
+#include "Weapon.h"
+
+// Live bullets stored as parallel arrays (structure of arrays), so the
+// per-tick position update is one straight pass the CPU can vectorise.
+// Removal swaps the last bullet into the hole, so order is not kept.
+class BulletPool {
+    public:
+        void Add(float x, float y, float dx, float dy, float speed, int damage);
+        void Add(const Bullet& bullet);
+        Bullet Get(int index) const;
+        int Size() const;
+        bool Empty() const;
+        void Clear();
+        void Reserve(int count);
+        int Capacity() const; // entries that fit before the arrays grow
+        // Moves the arrays into arena (null for the heap) with room for capacity
+        // bullets; the old storage is left to its arena
+        void UseArena(Arena* arena, int capacity);
+
+        // prev = pos; pos += dir * speed * deltaTime, for every bullet
+        void Integrate(float deltaTime);
+
+        // Kill marks a bullet; RemoveDead compacts all marked ones at once
+        void Kill(int index);
+        bool IsAlive(int index) const;
+        void RemoveDead();
+
+        float GetX(int index) const { return x[index]; }
+        float GetY(int index) const { return y[index]; }
+        float GetPrevX(int index) const { return prevX[index]; }
+        float GetPrevY(int index) const { return prevY[index]; }
+        float GetDX(int index) const { return dx[index]; }
+        float GetDY(int index) const { return dy[index]; }
+        float GetSpeed(int index) const { return speed[index]; }
+        int GetDamage(int index) const { return damage[index]; }
+        void SetPosition(int index, float newX, float newY) { x[index] = newX; y[index] = newY; }
+
+    private:
+        ArenaVector<float> x;
+        ArenaVector<float> y;
+        ArenaVector<float> prevX; // position before the last Integrate, for render interpolation
+        ArenaVector<float> prevY;
+        ArenaVector<float> dx;
+        ArenaVector<float> dy;
+        ArenaVector<float> speed;
+        ArenaVector<int> damage;
+        ArenaVector<uint8_t> alive;
+        int deadCount = 0;
+
+        void MoveBullet(int from, int to);
+        void PopBack();
+};
+
+// Kernel behind Integrate, exposed so tests and benchmarks can compare it
+// with the plain loop. Uses AVX2 or SSE2 when the build enables them.
+namespace BulletKernels {
+    void Integrate(float* x, float* y, float* prevX, float* prevY,
+                   const float* dx, const float* dy, const float* speed,
+                   int count, float deltaTime);
+    void IntegrateScalar(float* x, float* y, float* prevX, float* prevY,
+                         const float* dx, const float* dy, const float* speed,
+                         int count, float deltaTime);
+}
+
+#endif // BULLET_POOL_H
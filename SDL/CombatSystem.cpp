@@ -1,7 +1,8 @@
 #include "CombatSystem.h"
 
 #include <algorithm>
-#include <SDL2/SDL.h>
+#include <cmath>
+#include <limits>
 
 namespace CombatSystem {
 
@@ -12,35 +13,88 @@ bool AABB(const Entity& a, const Entity& b) {
             a.y + a.height > b.y);
 }
 
+void BuildEnemyGrid(SpatialHash& grid, const std::vector<Enemy>& enemies) {
+    grid.Clear();
+    for (int i = 0; i < (int)enemies.size(); i++) {
+        if (!enemies[i].IsDead()) {
+            grid.Insert(i, enemies[i].getBody());
+        }
+    }
+    grid.Build();
+}
+
+void BuildEnemyGrid(SpatialHash& grid, const EnemyPool& enemies) {
+    grid.Clear();
+    for (int i = 0; i < enemies.Size(); i++) {
+        if (!enemies.IsDead(i)) {
+            grid.Insert(i, enemies.GetBody(i));
+        }
+    }
+    grid.Build();
+}
+
+namespace {
+
+void ToPool(const std::vector<Enemy>& enemies, EnemyPool& pool) {
+    pool.Reserve((int)enemies.size());
+    for (const Enemy& enemy : enemies) {
+        pool.Add(enemy);
+    }
+}
+
+void FromPool(const EnemyPool& pool, std::vector<Enemy>& enemies) {
+    enemies.clear();
+    for (int i = 0; i < pool.Size(); i++) {
+        enemies.push_back(pool.Get(i));
+    }
+}
+}
+
 void UpdateEnemy(
     float deltaTime,
     std::vector<Enemy>& enemies,
     const Entity& player,
     int playerMeleeDamage,
-    const std::function<bool(const Entity&, float, float)>& collisionFunc,
+    const TileCollisionView& tiles,
     bool meleePressed,
     bool& levelComplete) {
 
+    EnemyPool pool;
+    ToPool(enemies, pool);
+    SpatialHash enemyGrid;
+    BuildEnemyGrid(enemyGrid, pool);
+    UpdateEnemy(deltaTime, pool, enemyGrid, player, playerMeleeDamage, tiles, FlowField(), meleePressed, levelComplete);
+    FromPool(pool, enemies);
+}
+
+void UpdateEnemy(
+    float deltaTime,
+    EnemyPool& enemies,
+    const SpatialHash& enemyGrid,
+    const Entity& player,
+    int playerMeleeDamage,
+    const TileCollisionView& tiles,
+    const FlowField& chaseField,
+    bool meleePressed,
+    bool& levelComplete,
+    JobSystem* jobs) {
+
     if (meleePressed) {
-        for (auto& enemy : enemies) {
-            if (!enemy.IsDead() && AABB(player, enemy.getBody())) {
-                enemy.TakeDamage(playerMeleeDamage);
+        ArenaVector<int> nearby{ArenaAllocator<int>(enemyGrid.GetScratchArena())}; // frame scratch, reclaimed next Step
+        enemyGrid.Query(player, nearby);
+        for (int index : nearby) {
+            if (!enemies.IsDead(index) && AABB(player, enemies.GetBody(index))) {
+                enemies.TakeDamage(index, playerMeleeDamage);
             }
         }
     }
 
-    Enemy::UpdateContext updateContext{deltaTime, player.x, player.y, collisionFunc};
-    for (auto& enemy : enemies) {
-        enemy.Update(updateContext);
-    }
-
-    enemies.erase(
-        std::remove_if(enemies.begin(), enemies.end(),
-            [](Enemy& enemy) { return enemy.IsRemovable(); }),
-        enemies.end()
-    );
+    Enemy::UpdateContext updateContext{deltaTime, player.x, player.y, tiles, &chaseField, jobs};
+    enemies.Update(updateContext);
+    // merge step, back on this thread
+    enemies.RemoveFinished();
     // Check if all enemies are defeated after updating so its on the same frame as the last enemy dies, not the next frame
-    if (enemies.empty()) {
+    if (enemies.Empty()) {
         levelComplete = true;
     }
 }
@@ -54,22 +108,43 @@ void UpdatePlayerCollision(
     float& playerInvulnTimer,
     float playerSpeed,
     int& playerHP,
-    const std::function<bool(const Entity&, float, float)>& collisionFunc
+    const TileCollisionView& tiles
+) {
+    EnemyPool pool;
+    ToPool(enemies, pool);
+    SpatialHash enemyGrid;
+    BuildEnemyGrid(enemyGrid, pool);
+    UpdatePlayerCollision(deltaTime, dx, dy, player, pool, enemyGrid, playerInvulnTimer, playerSpeed, playerHP, tiles);
+}
+
+void UpdatePlayerCollision(
+    float deltaTime,
+    float dx,
+    float dy,
+    Entity& player,
+    const EnemyPool& enemies,
+    const SpatialHash& enemyGrid,
+    float& playerInvulnTimer,
+    float playerSpeed,
+    int& playerHP,
+    const TileCollisionView& tiles
 ) {
     float nextX = player.x + dx * playerSpeed * deltaTime;
     float nextY = player.y + dy * playerSpeed * deltaTime;
 
-    if (!collisionFunc(player, nextX, player.y)) {
+    if (!tiles.Collides(player, nextX, player.y)) {
         player.x = nextX;
     }
 
-    if (!collisionFunc(player, player.x, nextY)) {
+    if (!tiles.Collides(player, player.x, nextY)) {
         player.y = nextY;
     }
 
-    for (auto& enemy : enemies) {
-        if (AABB(player, enemy.getBody())) {
-            if (!enemy.IsDead() && playerInvulnTimer <= 0.0f) {
+    ArenaVector<int> nearby{ArenaAllocator<int>(enemyGrid.GetScratchArena())};
+    enemyGrid.Query(player, nearby);
+    for (int index : nearby) {
+        if (AABB(player, enemies.GetBody(index))) {
+            if (!enemies.IsDead(index) && playerInvulnTimer <= 0.0f) {
                 playerHP -= 10;
                 playerInvulnTimer = 1.0f;
             }
@@ -81,7 +156,7 @@ void DetectMouseClick(
     const Entity& player,
     std::vector<Weapon>& playerWeapons,
     int currentWeaponIndex,
-    std::vector<Bullet>& bullets,
+    BulletPool& bullets,
     float worldMouseX,
     float worldMouseY,
     bool firePressed
@@ -101,51 +176,191 @@ void DetectMouseClick(
     }
 }
 
+bool SweepAABB(const Entity& moving, float moveX, float moveY, const Entity& target, float& hitTime) {
+    if (AABB(moving, target)) {
+        hitTime = 0.0f;
+        return true;
+    }
+
+    // Slab test against the target grown by the moving box, over t in [0, 1]
+    float tEnter = 0.0f;
+    float tExit = 1.0f;
+    if (moveX == 0.0f) {
+        if (moving.x >= target.x + target.width || moving.x + moving.width <= target.x) {
+            return false;
+        }
+    } else {
+        float t1 = (target.x - (moving.x + moving.width)) / moveX;
+        float t2 = (target.x + target.width - moving.x) / moveX;
+        tEnter = std::max(tEnter, std::min(t1, t2));
+        tExit = std::min(tExit, std::max(t1, t2));
+    }
+    if (moveY == 0.0f) {
+        if (moving.y >= target.y + target.height || moving.y + moving.height <= target.y) {
+            return false;
+        }
+    } else {
+        float t1 = (target.y - (moving.y + moving.height)) / moveY;
+        float t2 = (target.y + target.height - moving.y) / moveY;
+        tEnter = std::max(tEnter, std::min(t1, t2));
+        tExit = std::min(tExit, std::max(t1, t2));
+    }
+
+    // touching edges is not an overlap, same as AABB()
+    if (tEnter >= tExit) {
+        return false;
+    }
+    hitTime = tEnter;
+    return true;
+}
+
+bool RaycastTiles(
+    float startX,
+    float startY,
+    float endX,
+    float endY,
+    const TileCollisionView& tiles,
+    float& hitTime,
+    int& hitTileX,
+    int& hitTileY
+) {
+    const float tileSize = (float)tiles.tileSize;
+    int tileX = (int)std::floor(startX / tileSize);
+    int tileY = (int)std::floor(startY / tileSize);
+    if (tiles.IsSolidTile(tileX, tileY)) {
+        hitTime = 0.0f;
+        hitTileX = tileX;
+        hitTileY = tileY;
+        return true;
+    }
+
+    // Walk the grid one tile boundary at a time (Amanatides & Woo)
+    float dirX = endX - startX;
+    float dirY = endY - startY;
+    int stepX = (dirX > 0.0f) ? 1 : (dirX < 0.0f ? -1 : 0);
+    int stepY = (dirY > 0.0f) ? 1 : (dirY < 0.0f ? -1 : 0);
+    const float never = std::numeric_limits<float>::infinity();
+    float nextBoundaryX = (stepX > 0) ? (tileX + 1) * tileSize : tileX * tileSize;
+    float nextBoundaryY = (stepY > 0) ? (tileY + 1) * tileSize : tileY * tileSize;
+    float tMaxX = (stepX != 0) ? (nextBoundaryX - startX) / dirX : never;
+    float tMaxY = (stepY != 0) ? (nextBoundaryY - startY) / dirY : never;
+    float tDeltaX = (stepX != 0) ? tileSize / std::fabs(dirX) : never;
+    float tDeltaY = (stepY != 0) ? tileSize / std::fabs(dirY) : never;
+
+    while (true) {
+        float t;
+        if (tMaxX < tMaxY) {
+            t = tMaxX;
+            tileX += stepX;
+            tMaxX += tDeltaX;
+        } else {
+            t = tMaxY;
+            tileY += stepY;
+            tMaxY += tDeltaY;
+        }
+        if (t > 1.0f) {
+            return false;
+        }
+        if (tiles.IsSolidTile(tileX, tileY)) {
+            hitTime = t;
+            hitTileX = tileX;
+            hitTileY = tileY;
+            return true;
+        }
+    }
+}
+
 void UpdateBullets(
     float deltaTime,
     std::vector<Bullet>& bullets,
     std::vector<Enemy>& enemies,
-    const std::function<bool(const Entity&, float, float)>& collisionFunc,
-    const std::function<void(float, float, int)>& onWallHit
+    const TileCollisionView& tiles,
+    WallHitCallback onWallHit
 ) {
-    for (auto& bullet : bullets) {
-        bullet.x += bullet.dx * bullet.speed * deltaTime;
-        bullet.y += bullet.dy * bullet.speed * deltaTime;
+    EnemyPool enemyPool;
+    ToPool(enemies, enemyPool);
+    SpatialHash enemyGrid;
+    BuildEnemyGrid(enemyGrid, enemyPool);
+    BulletPool pool;
+    pool.Reserve((int)bullets.size());
+    for (const Bullet& bullet : bullets) {
+        pool.Add(bullet);
+    }
+    UpdateBullets(deltaTime, pool, enemyPool, enemyGrid, tiles, onWallHit);
+    bullets.clear();
+    for (int i = 0; i < pool.Size(); i++) {
+        bullets.push_back(pool.Get(i));
     }
+    FromPool(enemyPool, enemies);
+}
 
-    for (auto& bullet : bullets) {
-        Entity bulletEntity{bullet.x, bullet.y, 5, 5};
+void UpdateBullets(
+    float deltaTime,
+    BulletPool& bullets,
+    EnemyPool& enemies,
+    const SpatialHash& enemyGrid,
+    const TileCollisionView& tiles,
+    WallHitCallback onWallHit
+) {
+    const float bulletSize = 5.0f;
+    const float tileSize = (float)tiles.tileSize;
+    // wall tests trace the one point DetectCollision samples on a 5x5 bullet
+    const float wallProbeOffset = 2.0f;
 
-        for (auto& enemy : enemies) {
-            if (!enemy.IsDead() && AABB(bulletEntity, enemy.getBody())) {
-                enemy.TakeDamage(bullet.damage);
-                bullet.toDelete = true;
-                break; // bullet only hits one enemy
+    bullets.Integrate(deltaTime);
+
+    ArenaVector<int> nearby{ArenaAllocator<int>(enemyGrid.GetScratchArena())};
+    for (int i = 0; i < bullets.Size(); i++) {
+        float startX = bullets.GetPrevX(i);
+        float startY = bullets.GetPrevY(i);
+        float endX = bullets.GetX(i);
+        float endY = bullets.GetY(i);
+        float moveX = endX - startX;
+        float moveY = endY - startY;
+
+        float wallTime = 2.0f; // > 1 means no wall along this step
+        int wallTileX = 0;
+        int wallTileY = 0;
+        RaycastTiles(
+            startX + wallProbeOffset, startY + wallProbeOffset,
+            endX + wallProbeOffset, endY + wallProbeOffset,
+            tiles, wallTime, wallTileX, wallTileY
+        );
+
+        // Earliest enemy along the path; ties go to the lowest index like a full scan
+        Entity start{startX, startY, bulletSize, bulletSize};
+        Entity swept{
+            std::min(startX, endX),
+            std::min(startY, endY),
+            std::fabs(moveX) + bulletSize,
+            std::fabs(moveY) + bulletSize
+        };
+        nearby.clear();
+        enemyGrid.Query(swept, nearby);
+        std::sort(nearby.begin(), nearby.end());
+        int hitEnemy = -1;
+        float enemyTime = 2.0f;
+        for (int index : nearby) {
+            float t;
+            if (!enemies.IsDead(index) && SweepAABB(start, moveX, moveY, enemies.GetBody(index), t) && t < enemyTime) {
+                hitEnemy = index;
+                enemyTime = t;
             }
         }
+
+        if (hitEnemy >= 0 && enemyTime <= wallTime) {
+            enemies.TakeDamage(hitEnemy, bullets.GetDamage(i)); // bullet only hits one enemy
+            bullets.Kill(i);
+        } else if (wallTime <= 1.0f) {
+            onWallHit((wallTileX + 0.5f) * tileSize, (wallTileY + 0.5f) * tileSize, bullets.GetDamage(i));
+            bullets.Kill(i);
+        }
+        if (!bullets.IsAlive(i)) {
+            float hitTime = std::min(enemyTime, wallTime);
+            bullets.SetPosition(i, startX + moveX * hitTime, startY + moveY * hitTime);
+        }
     }
-    
-    bullets.erase(
-        std::remove_if(bullets.begin(), bullets.end(),
-            [](const Bullet& b) { return b.toDelete; }),
-        bullets.end()
-    );
-    bullets.erase(
-        std::remove_if(bullets.begin(), bullets.end(),
-            [&](const Bullet& bullet) {
-                Entity bulletEntity{bullet.x, bullet.y, 5, 5};
-                if (collisionFunc(bulletEntity, bullet.x, bullet.y)) {
-                    // Call wall hit effect with bullet position and damage
-                    if (onWallHit) {
-                        onWallHit(bullet.x + bulletEntity.width * 0.5f,
-                                bullet.y + bulletEntity.height * 0.5f,
-                                bullet.damage);
-                            }
-                    return true;
-                }
-                return false;
-            }),
-        bullets.end()
-    );
+
+    bullets.RemoveDead();
 }
 }
\ No newline at end of file
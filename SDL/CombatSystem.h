@@ -2,25 +2,76 @@
 #define COMBAT_SYSTEM_H
 
 #include <vector>
-#include <functional>
 #include "Entity.h"
 #include "Enemy.h"
+#include "EnemyPool.h"
+#include "JobSystem.h"
 #include "Weapon.h"
+#include "SpatialHash.h"
+#include "BulletPool.h"
+#include "TileCollisionView.h"
 
 namespace CombatSystem {
 
+// Non-owning reference to whatever handles a bullet hitting a wall at
+// (worldX, worldY), called straight through a function pointer. Unlike a
+// std::function it costs nothing to build each tick; the callable must
+// outlive the UpdateBullets call it is passed to.
+class WallHitCallback {
+    public:
+        template <typename Callable>
+        WallHitCallback(const Callable& callable) {
+            target = &callable;
+            invoke = [](const void* target, float worldX, float worldY, int damage) {
+                (*static_cast<const Callable*>(target))(worldX, worldY, damage);
+            };
+        }
+
+        void operator()(float worldX, float worldY, int damage) const {
+            invoke(target, worldX, worldY, damage);
+        }
+
+    private:
+        const void* target;
+        void (*invoke)(const void* target, float worldX, float worldY, int damage);
+};
+
 bool AABB(const Entity& a, const Entity& b);
 
+// Indexes every live enemy by its position in the vector or pool.
+// Rebuild whenever enemies move or the container is compacted.
+void BuildEnemyGrid(SpatialHash& grid, const std::vector<Enemy>& enemies);
+void BuildEnemyGrid(SpatialHash& grid, const EnemyPool& enemies);
+
+// The std::vector<Enemy> overloads run the pool versions on a copy and
+// write the enemies back grouped by type, so their order is not kept.
+
 void UpdateEnemy(
     float deltaTime,
     std::vector<Enemy>& enemies,
     const Entity& player,
     int playerMeleeDamage,
-    const std::function<bool(const Entity&, float, float)>& collisionFunc,
+    const TileCollisionView& tiles,
     bool meleePressed,
     bool& levelComplete
 );
 
+// Melee hits land first, then every enemy moves (spread over jobs when
+// given). Removing finished enemies and the level-complete check run after
+// the parallel pass, in index order, so results don't depend on threads.
+void UpdateEnemy(
+    float deltaTime,
+    EnemyPool& enemies,
+    const SpatialHash& enemyGrid,
+    const Entity& player,
+    int playerMeleeDamage,
+    const TileCollisionView& tiles,
+    const FlowField& chaseField,
+    bool meleePressed,
+    bool& levelComplete,
+    JobSystem* jobs = nullptr
+);
+
 void UpdatePlayerCollision(
     float deltaTime,
     float dx,
@@ -30,14 +81,27 @@ void UpdatePlayerCollision(
     float& playerInvulnTimer,
     float playerSpeed,
     int& playerHP,
-    const std::function<bool(const Entity&, float, float)>& collisionFunc
+    const TileCollisionView& tiles
+);
+
+void UpdatePlayerCollision(
+    float deltaTime,
+    float dx,
+    float dy,
+    Entity& player,
+    const EnemyPool& enemies,
+    const SpatialHash& enemyGrid,
+    float& playerInvulnTimer,
+    float playerSpeed,
+    int& playerHP,
+    const TileCollisionView& tiles
 );
 
 void DetectMouseClick(
     const Entity& player,
     std::vector<Weapon>& playerWeapons,
     int currentWeaponIndex,
-    std::vector<Bullet>& bullets,
+    BulletPool& bullets,
     float worldMouseX,
     float worldMouseY,
     bool firePressed
@@ -47,8 +111,37 @@ void UpdateBullets(
     float deltaTime,
     std::vector<Bullet>& bullets,
     std::vector<Enemy>& enemies,
-    const std::function<bool(const Entity&, float, float)>& collisionFunc,
-    const std::function<void(float, float, int)>& onWallHit
+    const TileCollisionView& tiles,
+    WallHitCallback onWallHit
+);
+
+// Sweeps moving by (moveX, moveY) against target. On overlap, hitTime is the
+// fraction of the move at first contact (0 if they already overlap).
+bool SweepAABB(const Entity& moving, float moveX, float moveY, const Entity& target, float& hitTime);
+
+// Walks the tiles crossed by the segment and stops at the first solid one.
+// hitTime is the fraction of the segment at which that tile is entered.
+bool RaycastTiles(
+    float startX,
+    float startY,
+    float endX,
+    float endY,
+    const TileCollisionView& tiles,
+    float& hitTime,
+    int& hitTileX,
+    int& hitTileY
+);
+
+// Bullets are swept over the whole step, so fast shots cannot tunnel through
+// walls or enemies at low tick rates. Each bullet stops at its earliest hit.
+// enemyGrid must be built from enemies after their last move this tick.
+void UpdateBullets(
+    float deltaTime,
+    BulletPool& bullets,
+    EnemyPool& enemies,
+    const SpatialHash& enemyGrid,
+    const TileCollisionView& tiles,
+    WallHitCallback onWallHit
 );
 
 }
@@ -6,4 +6,24 @@ const int PLAYER_SIZE = 50;
 const int TILE_SIZE   = 50;
 constexpr float BASE_PLAYER_SPEED = 200.0f;
 
+// Simulation runs at a fixed rate; rendering interpolates between ticks.
+constexpr float SIM_TICK_RATE = 120.0f;
+constexpr int MAX_SIM_STEPS_PER_FRAME = 8; // catch-up clamp after a long frame
+
+// Map size in tiles; the World can be built with anything from MIN_MAP_SIZE
+// up to MAX_MAP_SIZE
+const int DEFAULT_MAP_WIDTH  = 16;
+const int DEFAULT_MAP_HEIGHT = 16;
+const int MIN_MAP_SIZE = 3;
+const int MAX_MAP_SIZE = 4096;
+
+// Smart enemies give up chasing well inside this many tiles, so the chase
+// flow field only searches this far around the player.
+const int CHASE_FIELD_RADIUS = 32;
+
+// Per-level storage reserved up front in the level arena, so play doesn't
+// allocate; going past it costs one more arena block, not a heap trip per push.
+const int LEVEL_BULLET_CAPACITY = 256;
+const int LEVEL_WALL_EFFECT_CAPACITY = 64;
+
 #endif // CONFIG_H
\ No newline at end of file
@@ -2,46 +2,10 @@
 
 #include <stdio.h>
 #include <cmath>
-#include <vector>
-#include <string>
 #include "Enemy.h"
+#include "EnemyPool.h"
 #include "Entity.h"
 #include "Config.h"
-#include <SDL2/SDL_image.h>
-
-namespace {
-SDL_Texture* LoadTextureWithFallback(SDL_Renderer* renderer, const std::string& relativePath) {
-    std::vector<std::string> candidatePaths = {
-        relativePath,
-        "SDL/" + relativePath,
-        "../" + relativePath,
-        "../../SDL/" + relativePath
-    };
-
-    char* basePathRaw = SDL_GetBasePath();
-    if (basePathRaw) {
-        std::string basePath(basePathRaw);
-        candidatePaths.push_back(basePath + relativePath);
-        candidatePaths.push_back(basePath + "../" + relativePath);
-        candidatePaths.push_back(basePath + "../SDL/" + relativePath);
-        SDL_free(basePathRaw);
-    }
-
-    for (const std::string& path : candidatePaths) {
-        SDL_Texture* texture = IMG_LoadTexture(renderer, path.c_str());
-        if (texture) {
-            return texture;
-        }
-    }
-
-    return nullptr;
-}
-}
-
-SDL_Texture* Enemy::horizontalTexture = nullptr;
-SDL_Texture* Enemy::verticalTexture = nullptr;
-SDL_Texture* Enemy::smartTexture = nullptr;
-bool Enemy::texturesLoaded = false;
 
 // ---------------- Constructor ----------------
 Enemy::Enemy(float startX, float startY, EnemyType type, int level, float difficultyMultiplier) {
@@ -49,7 +13,8 @@ Enemy::Enemy(float startX, float startY, EnemyType type, int level, float diffic
     body.y = startY;
     body.width = PLAYER_SIZE;
     body.height = PLAYER_SIZE;
-    tileSize = TILE_SIZE;
+    prevX = startX;
+    prevY = startY;
     directionX = 1;
     directionY = 1;
     character = type;
@@ -59,37 +24,10 @@ Enemy::Enemy(float startX, float startY, EnemyType type, int level, float diffic
     maxHealth = baseHealth + (level - 1) * 2 * difficultyMultiplier;
     health = maxHealth;
     isDying = false;
-    deathDuration = 0.25f;
     deathTimer = 0.0f;
     maxdistance = 200.0f + (level - 1) * 5.0f;
 }
 
-void Enemy::EnsureTexturesLoaded(SDL_Renderer* renderer) {
-    if (texturesLoaded || renderer == nullptr) {
-        return;
-    }
-    horizontalTexture = LoadTextureWithFallback(renderer, "sprites/enemy.png");
-    verticalTexture = LoadTextureWithFallback(renderer, "sprites/enemy2.png");
-    smartTexture = LoadTextureWithFallback(renderer, "sprites/enemy3.png");
-    texturesLoaded = true;
-}
-
-void Enemy::ReleaseTextures() {
-    if (horizontalTexture) {
-        SDL_DestroyTexture(horizontalTexture);
-        horizontalTexture = nullptr;
-    }
-    if (verticalTexture) {
-        SDL_DestroyTexture(verticalTexture);
-        verticalTexture = nullptr;
-    }
-    if (smartTexture) {
-        SDL_DestroyTexture(smartTexture);
-        smartTexture = nullptr;
-    }
-    texturesLoaded = false;
-}
-
 float Enemy::GetX() const {
     return body.x;
 }
@@ -98,6 +36,14 @@ float Enemy::GetY() const {
     return body.y;
 }
 
+float Enemy::GetInterpolatedX(float alpha) const {
+    return prevX + (body.x - prevX) * alpha;
+}
+
+float Enemy::GetInterpolatedY(float alpha) const {
+    return prevY + (body.y - prevY) * alpha;
+}
+
 const Entity& Enemy::getBody() const {
     return body;
 }
@@ -151,151 +97,28 @@ bool Enemy::CheckIfDying(const UpdateContext& context) {
     return false;
 }
 
+// Same kernels the pool runs, over a batch of one
 void Enemy::UpdateMovementByType(const UpdateContext& context) {
+    const uint8_t dying = 0;
     switch (character) {
         case horizontalEnemy:
-            HorizontalMove(context);
+            EnemyKernels::MoveHorizontal(&body.x, &body.y, &directionX, &speed, &dying, 1, context.tiles, context.deltaTime);
             break;
         case verticalEnemy:
-            VerticalMove(context);
+            EnemyKernels::MoveVertical(&body.x, &body.y, &directionY, &speed, &dying, 1, context.tiles, context.deltaTime);
             break;
         case smartEnemy:
-            SmartEnemy(context);
+            EnemyKernels::MoveSmart(&body.x, &body.y, &speed, &maxdistance, &dying, 1,
+                                    context.playerX, context.playerY, context.flowField, context.tiles, context.deltaTime);
             break;
     }
 }
 
 void Enemy::Update(const UpdateContext& context) {
+    prevX = body.x;
+    prevY = body.y;
     if (CheckIfDying(context)) {
         return;
     }
     UpdateMovementByType(context);
 }
-
-void Enemy::HorizontalMove(const UpdateContext& context) {
-    float nextX = body.x + directionX * speed * context.deltaTime;
-    if (context.collisionFunc(body, nextX, body.y)) {
-        directionX = -directionX; // reverse
-    } else {
-        body.x = nextX;
-    }
-}
-
-void Enemy::VerticalMove(const UpdateContext& context) {
-    float nextY = body.y + directionY * speed * context.deltaTime;
-    if (context.collisionFunc(body, body.x, nextY)) {
-        directionY = -directionY; // reverse
-    } else {
-        body.y = nextY;
-    }
-}
-
-float Enemy::GetDistanceToPlayer(float dx, float dy) const {
-    return sqrt(dx*dx + dy*dy);
-}
-
-void Enemy::SmartEnemy(const UpdateContext& context) {
-    float dx = context.playerX - body.x;
-    float dy = context.playerY - body.y;
-    float distance = GetDistanceToPlayer(dx, dy);
-    // distance check to prevent division by zero and only move if player is within maxdistance 
-    if(distance > 0.0f && distance < maxdistance) { 
-        // Normalize the direction vector
-        dx /= distance;
-        dy /= distance;
-        // Move towards player
-        float nextX = body.x + dx * speed * context.deltaTime;
-        float nextY = body.y + dy * speed * context.deltaTime;
-        if(!context.collisionFunc(body, nextX, body.y)) body.x = nextX;
-        if(!context.collisionFunc(body, body.x, nextY)) body.y = nextY;
-    }
-}
-
-void Enemy::Render(float cameraX, float cameraY, SDL_Renderer* renderer) {
-    if (renderer == nullptr) {
-        return;
-    }
-    EnsureTexturesLoaded(renderer);
-    if (isDying) {
-        RenderDeathEffect(cameraX, cameraY, renderer);
-    } else {
-        RenderAliveEnemy(cameraX, cameraY, renderer);
-    }
-}
-
-void Enemy::SetEnemyTextureAndColor() {
-    if (character == horizontalEnemy) {
-        this->currentEnemyTexture = horizontalTexture;
-        this->baseR = 90; this->baseG = 252; this->baseB = 45;
-    } else if (character == verticalEnemy) {
-        this->currentEnemyTexture = verticalTexture;
-        this->baseR = 49; this->baseG = 90; this->baseB = 255;
-    } else if (character == smartEnemy) {
-        this->currentEnemyTexture = smartTexture;
-        this->baseR = 194; this->baseG = 45; this->baseB = 252;
-    }
-
-}
-
-float Enemy::GetProgress() const {
-    float progress = 1.0f - (deathTimer / deathDuration);
-    if (progress < 0.0f) progress = 0.0f;
-    if (progress > 1.0f) progress = 1.0f;
-    return progress;
-}
-
-void Enemy::RenderAliveEnemy(float cameraX, float cameraY, SDL_Renderer* renderer) {
-    //draw enemy
-    SDL_Rect enemyRect = DrawEnemyRectangle(cameraX, cameraY);
-    SetEnemyTextureAndColor();
-    float healthPercent = (float)health / maxHealth;
-    Uint8 r = this->baseR * healthPercent;
-    Uint8 g = this->baseG * healthPercent;
-    Uint8 b = this->baseB * healthPercent;
-    if (this->currentEnemyTexture) {
-        SDL_SetTextureColorMod(this->currentEnemyTexture, r, g, b);
-        SDL_SetTextureAlphaMod(this->currentEnemyTexture, 255);
-        SDL_SetTextureBlendMode(this->currentEnemyTexture, SDL_BLENDMODE_BLEND);
-        SDL_RenderCopy(renderer, this->currentEnemyTexture, nullptr, &enemyRect);
-    } else {
-        SDL_SetRenderDrawColor(renderer, r, g, b, 255);
-        SDL_RenderFillRect(renderer, &enemyRect);
-    }
-}
-
-void Enemy::RenderDeathEffect(float cameraX, float cameraY, SDL_Renderer* renderer) const {
-    float progress = GetProgress();
-        int expandedSize = (int)(body.width * (1.0f + 0.7f * progress));
-        int centerX = (int)(body.x + body.width * 0.5f - cameraX);
-        int centerY = (int)(body.y + body.height * 0.5f - cameraY);
-        SDL_Rect deathRect = {
-            centerX - expandedSize / 2,
-            centerY - expandedSize / 2,
-            expandedSize,
-            expandedSize
-        };
-        Uint8 baseR = 255;
-        Uint8 baseG = 100;
-        Uint8 baseB = 30;
-        if (character == smartEnemy) {
-            baseR = 194; baseG = 45; baseB = 252;
-        } else if (character == horizontalEnemy) {
-            baseR = 90; baseG = 252; baseB = 45;
-        } else if (character == verticalEnemy) {
-            baseR = 49; baseG = 90; baseB = 255;
-        }
-        Uint8 alpha = (Uint8)(255.0f * (1.0f - progress));
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-        SDL_SetRenderDrawColor(renderer, baseR, baseG, baseB, alpha);
-        SDL_RenderFillRect(renderer, &deathRect);
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
-        return;
-}
-
-SDL_Rect Enemy::DrawEnemyRectangle(float cameraX, float cameraY) const {
-    return {
-        (int)(body.x - cameraX), 
-        (int)(body.y - cameraY), 
-        (int)body.width, (int)body.height
-    };
-}
\ No newline at end of file
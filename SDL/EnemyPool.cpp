@@ -0,0 +1,293 @@
+// EnemyPool.cpp
+
+#include "EnemyPool.h"
+#include "JobSystem.h"
+
+#include <algorithm>
+#include <cmath>
+
+void EnemyPool::Add(const Enemy& enemy) {
+    int type = enemy.character;
+    int last = Size();
+    Resize(last + 1);
+    // Open a slot at the end of this type's group by moving the first enemy
+    // of each later group to that group's end, last group first.
+    for (int t = Enemy::typeCount - 1; t > type; t--) {
+        int begin = typeEnd[t - 1];
+        if (begin != typeEnd[t]) {
+            MoveEnemy(begin, typeEnd[t]);
+        }
+        typeEnd[t]++;
+    }
+    int slot = typeEnd[type];
+    typeEnd[type]++;
+
+    x[slot] = enemy.body.x;
+    y[slot] = enemy.body.y;
+    prevX[slot] = enemy.prevX;
+    prevY[slot] = enemy.prevY;
+    dirX[slot] = enemy.directionX;
+    dirY[slot] = enemy.directionY;
+    speed[slot] = enemy.speed;
+    maxDistance[slot] = enemy.maxdistance;
+    health[slot] = enemy.health;
+    maxHealth[slot] = enemy.maxHealth;
+    dying[slot] = enemy.isDying ? 1 : 0;
+    deathTimer[slot] = enemy.deathTimer;
+}
+
+Enemy EnemyPool::Get(int index) const {
+    Enemy enemy(x[index], y[index], GetType(index), 1, 1.0f);
+    enemy.prevX = prevX[index];
+    enemy.prevY = prevY[index];
+    enemy.directionX = dirX[index];
+    enemy.directionY = dirY[index];
+    enemy.speed = speed[index];
+    enemy.maxdistance = maxDistance[index];
+    enemy.health = health[index];
+    enemy.maxHealth = maxHealth[index];
+    enemy.isDying = dying[index] != 0;
+    enemy.deathTimer = deathTimer[index];
+    return enemy;
+}
+
+int EnemyPool::Size() const {
+    return (int)x.size();
+}
+
+bool EnemyPool::Empty() const {
+    return x.empty();
+}
+
+void EnemyPool::Clear() {
+    Resize(0);
+    for (int t = 0; t < Enemy::typeCount; t++) {
+        typeEnd[t] = 0;
+    }
+}
+
+void EnemyPool::Reserve(int count) {
+    x.reserve(count);
+    y.reserve(count);
+    prevX.reserve(count);
+    prevY.reserve(count);
+    dirX.reserve(count);
+    dirY.reserve(count);
+    speed.reserve(count);
+    maxDistance.reserve(count);
+    health.reserve(count);
+    maxHealth.reserve(count);
+    dying.reserve(count);
+    deathTimer.reserve(count);
+}
+
+int EnemyPool::Capacity() const {
+    return (int)x.capacity();
+}
+
+void EnemyPool::UseArena(Arena* arena, int capacity) {
+    RebindArena(x, arena, capacity);
+    RebindArena(y, arena, capacity);
+    RebindArena(prevX, arena, capacity);
+    RebindArena(prevY, arena, capacity);
+    RebindArena(dirX, arena, capacity);
+    RebindArena(dirY, arena, capacity);
+    RebindArena(speed, arena, capacity);
+    RebindArena(maxDistance, arena, capacity);
+    RebindArena(health, arena, capacity);
+    RebindArena(maxHealth, arena, capacity);
+    RebindArena(dying, arena, capacity);
+    RebindArena(deathTimer, arena, capacity);
+}
+
+Enemy::EnemyType EnemyPool::GetType(int index) const {
+    int type = 0;
+    while (index >= typeEnd[type]) {
+        type++;
+    }
+    return (Enemy::EnemyType)type;
+}
+
+void EnemyPool::Update(const Enemy::UpdateContext& context) {
+    if (context.jobs) {
+        context.jobs->ParallelFor(Size(), updateGrain, [&](int begin, int end) {
+            UpdateRange(context, begin, end);
+        });
+    } else {
+        UpdateRange(context, 0, Size());
+    }
+}
+
+// A range can straddle type groups; each group's share gets its own kernel
+void EnemyPool::UpdateRange(const Enemy::UpdateContext& context, int begin, int end) {
+    int count = end - begin;
+    if (count <= 0) {
+        return;
+    }
+    std::copy(x.begin() + begin, x.begin() + end, prevX.begin() + begin);
+    std::copy(y.begin() + begin, y.begin() + end, prevY.begin() + begin);
+    EnemyKernels::TickDeath(deathTimer.data() + begin, dying.data() + begin, count, context.deltaTime);
+
+    int h = std::max(begin, GetTypeBegin(Enemy::horizontalEnemy));
+    int hEnd = std::min(end, GetTypeEnd(Enemy::horizontalEnemy));
+    if (h < hEnd) {
+        EnemyKernels::MoveHorizontal(x.data() + h, y.data() + h, dirX.data() + h, speed.data() + h,
+                                     dying.data() + h, hEnd - h, context.tiles, context.deltaTime);
+    }
+    int v = std::max(begin, GetTypeBegin(Enemy::verticalEnemy));
+    int vEnd = std::min(end, GetTypeEnd(Enemy::verticalEnemy));
+    if (v < vEnd) {
+        EnemyKernels::MoveVertical(x.data() + v, y.data() + v, dirY.data() + v, speed.data() + v,
+                                   dying.data() + v, vEnd - v, context.tiles, context.deltaTime);
+    }
+    int s = std::max(begin, GetTypeBegin(Enemy::smartEnemy));
+    int sEnd = std::min(end, GetTypeEnd(Enemy::smartEnemy));
+    if (s < sEnd) {
+        EnemyKernels::MoveSmart(x.data() + s, y.data() + s, speed.data() + s, maxDistance.data() + s,
+                                dying.data() + s, sEnd - s, context.playerX, context.playerY,
+                                context.flowField, context.tiles, context.deltaTime);
+    }
+}
+
+void EnemyPool::TakeDamage(int index, int amount) {
+    if (dying[index] || health[index] <= 0) {
+        return;
+    }
+
+    health[index] -= amount;
+    // if health drops to 0 or below, start death animation
+    if (health[index] <= 0) {
+        health[index] = 0;
+        dying[index] = 1;
+        deathTimer[index] = Enemy::deathDuration;
+    }
+}
+
+void EnemyPool::RemoveFinished() {
+    int count = Size();
+    int first = 0;
+    while (first < count && !IsRemovable(first)) {
+        first++;
+    }
+    if (first == count) {
+        return;
+    }
+
+    // One pass that slides survivors down, keeping each group together
+    int write = first;
+    int read = first;
+    for (int t = 0; t < Enemy::typeCount; t++) {
+        for (; read < typeEnd[t]; read++) {
+            if (!IsRemovable(read)) {
+                MoveEnemy(read, write);
+                write++;
+            }
+        }
+        typeEnd[t] = write;
+    }
+    Resize(write);
+}
+
+float EnemyPool::GetDeathProgress(int index) const {
+    float progress = 1.0f - (deathTimer[index] / Enemy::deathDuration);
+    if (progress < 0.0f) progress = 0.0f;
+    if (progress > 1.0f) progress = 1.0f;
+    return progress;
+}
+
+void EnemyPool::MoveEnemy(int from, int to) {
+    x[to] = x[from];
+    y[to] = y[from];
+    prevX[to] = prevX[from];
+    prevY[to] = prevY[from];
+    dirX[to] = dirX[from];
+    dirY[to] = dirY[from];
+    speed[to] = speed[from];
+    maxDistance[to] = maxDistance[from];
+    health[to] = health[from];
+    maxHealth[to] = maxHealth[from];
+    dying[to] = dying[from];
+    deathTimer[to] = deathTimer[from];
+}
+
+void EnemyPool::Resize(int count) {
+    x.resize(count);
+    y.resize(count);
+    prevX.resize(count);
+    prevY.resize(count);
+    dirX.resize(count);
+    dirY.resize(count);
+    speed.resize(count);
+    maxDistance.resize(count);
+    health.resize(count);
+    maxHealth.resize(count);
+    dying.resize(count);
+    deathTimer.resize(count);
+}
+
+// ====== Kernels ======
+
+namespace EnemyKernels {
+
+void TickDeath(float* deathTimer, const uint8_t* dying, int count, float deltaTime) {
+    for (int i = 0; i < count; i++) {
+        float next = deathTimer[i] - (dying[i] ? deltaTime : 0.0f);
+        deathTimer[i] = next < 0.0f ? 0.0f : next;
+    }
+}
+
+// The wall probe is the only call left in these loops; whether the enemy
+// moves or turns is a select on its result, not a branch.
+void MoveHorizontal(float* x, const float* y, float* dirX, const float* speed,
+                    const uint8_t* dying, int count,
+                    const TileCollisionView& tiles, float deltaTime) {
+    const Entity box{0.0f, 0.0f, PLAYER_SIZE, PLAYER_SIZE};
+    for (int i = 0; i < count; i++) {
+        float nextX = x[i] + dirX[i] * speed[i] * deltaTime;
+        bool active = !dying[i];
+        bool blocked = tiles.Collides(box, nextX, y[i]);
+        x[i] = (active && !blocked) ? nextX : x[i];
+        dirX[i] = (active && blocked) ? -dirX[i] : dirX[i];
+    }
+}
+
+void MoveVertical(const float* x, float* y, float* dirY, const float* speed,
+                  const uint8_t* dying, int count,
+                  const TileCollisionView& tiles, float deltaTime) {
+    const Entity box{0.0f, 0.0f, PLAYER_SIZE, PLAYER_SIZE};
+    for (int i = 0; i < count; i++) {
+        float nextY = y[i] + dirY[i] * speed[i] * deltaTime;
+        bool active = !dying[i];
+        bool blocked = tiles.Collides(box, x[i], nextY);
+        y[i] = (active && !blocked) ? nextY : y[i];
+        dirY[i] = (active && blocked) ? -dirY[i] : dirY[i];
+    }
+}
+
+void MoveSmart(float* x, float* y, const float* speed, const float* maxDistance,
+               const uint8_t* dying, int count, float playerX, float playerY,
+               const FlowField* flowField, const TileCollisionView& tiles, float deltaTime) {
+    const Entity box{0.0f, 0.0f, PLAYER_SIZE, PLAYER_SIZE};
+    const float halfSize = PLAYER_SIZE * 0.5f;
+    for (int i = 0; i < count; i++) {
+        float dx = playerX - x[i];
+        float dy = playerY - y[i];
+        float distance = std::sqrt(dx * dx + dy * dy);
+        // distance check to prevent division by zero and only move if player is within maxDistance
+        if (dying[i] || !(distance > 0.0f && distance < maxDistance[i])) {
+            continue;
+        }
+        dx /= distance;
+        dy /= distance;
+        // Follow the flow field around walls; it has no direction once we share the player's tile
+        if (flowField) {
+            flowField->Steer(x[i] + halfSize, y[i] + halfSize, dx, dy);
+        }
+        float nextX = x[i] + dx * speed[i] * deltaTime;
+        float nextY = y[i] + dy * speed[i] * deltaTime;
+        x[i] = tiles.Collides(box, nextX, y[i]) ? x[i] : nextX;
+        y[i] = tiles.Collides(box, x[i], nextY) ? y[i] : nextY;
+    }
+}
+
+}
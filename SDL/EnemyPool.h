@@ -0,0 +1,104 @@
+// EnemyPool.h
+#ifndef ENEMY_POOL_H
+#define ENEMY_POOL_H
+
+#include <cstdint>
+#include <vector>
+#include "Arena.h"
+#include "Entity.h"
+#include "Enemy.h"
+#include "Config.h"
+#include "TileCollisionView.h"
+#include "FlowField.h"
+
+// Live enemies stored as parallel arrays (structure of arrays), grouped by
+// EnemyType: all horizontal movers first, then vertical, then smart. Each
+// group runs its own movement kernel with no per-enemy type switch.
+// Only what the tick reads is stored; sprites and colours come from the
+// type at draw time, and every enemy is PLAYER_SIZE square.
+// Add keeps the groups intact by moving at most one enemy per later group,
+// so order inside a group is not kept.
+class EnemyPool {
+    public:
+        void Add(const Enemy& enemy);
+        Enemy Get(int index) const;
+        int Size() const;
+        bool Empty() const;
+        void Clear();
+        void Reserve(int count);
+        int Capacity() const; // entries that fit before the arrays grow
+        // Moves the arrays into arena (null for the heap) with room for capacity
+        // enemies; the old storage is left to its arena
+        void UseArena(Arena* arena, int capacity);
+
+        // indices [GetTypeBegin, GetTypeEnd) hold the enemies of that type
+        int GetTypeBegin(Enemy::EnemyType type) const { return type == 0 ? 0 : typeEnd[type - 1]; }
+        int GetTypeEnd(Enemy::EnemyType type) const { return typeEnd[type]; }
+        Enemy::EnemyType GetType(int index) const;
+
+        // Same rules as Enemy::Update, for every enemy. With context.jobs set,
+        // ranges of updateGrain enemies run in parallel; each enemy only
+        // writes its own slots, so the result is identical for any thread count.
+        static constexpr int updateGrain = 256;
+        void Update(const Enemy::UpdateContext& context);
+
+        void TakeDamage(int index, int amount);
+        void RemoveFinished(); // drops enemies whose death effect has played out
+
+        float GetX(int index) const { return x[index]; }
+        float GetY(int index) const { return y[index]; }
+        float GetPrevX(int index) const { return prevX[index]; }
+        float GetPrevY(int index) const { return prevY[index]; }
+        float GetInterpolatedX(int index, float alpha) const { return prevX[index] + (x[index] - prevX[index]) * alpha; }
+        float GetInterpolatedY(int index, float alpha) const { return prevY[index] + (y[index] - prevY[index]) * alpha; }
+        Entity GetBody(int index) const { return Entity{x[index], y[index], PLAYER_SIZE, PLAYER_SIZE}; }
+        float GetSpeed(int index) const { return speed[index]; }
+        int GetHP(int index) const { return health[index]; }
+        int GetMaxHP(int index) const { return maxHealth[index]; }
+        bool IsDead(int index) const { return health[index] <= 0; }
+        bool IsDying(int index) const { return dying[index] != 0; }
+        bool IsRemovable(int index) const { return dying[index] && deathTimer[index] <= 0.0f; }
+        float GetDeathProgress(int index) const; // 0 when the effect starts, 1 when it ends
+
+    private:
+        // hot: read or written every tick
+        ArenaVector<float> x;
+        ArenaVector<float> y;
+        ArenaVector<float> dirX;
+        ArenaVector<float> dirY;
+        ArenaVector<float> speed;
+        ArenaVector<float> maxDistance; // smart enemies chase inside this range
+        ArenaVector<int> health;
+        ArenaVector<uint8_t> dying;
+        ArenaVector<float> deathTimer;
+        // warm: written every tick, read when drawing
+        ArenaVector<float> prevX; // position before the last Update, for render interpolation
+        ArenaVector<float> prevY;
+        // cold: only touched on damage and draw
+        ArenaVector<int> maxHealth;
+        int typeEnd[Enemy::typeCount] = {};
+
+        void UpdateRange(const Enemy::UpdateContext& context, int begin, int end);
+        void MoveEnemy(int from, int to);
+        void Resize(int count);
+};
+
+// Kernels behind Update, one per enemy type. Enemy::Update runs the same
+// ones over a single enemy, so both paths move enemies identically.
+// Dying enemies hold still; a mover that would hit a wall turns around.
+namespace EnemyKernels {
+    void TickDeath(float* deathTimer, const uint8_t* dying, int count, float deltaTime);
+    void MoveHorizontal(float* x, const float* y, float* dirX, const float* speed,
+                        const uint8_t* dying, int count,
+                        const TileCollisionView& tiles, float deltaTime);
+    void MoveVertical(const float* x, float* y, float* dirY, const float* speed,
+                      const uint8_t* dying, int count,
+                      const TileCollisionView& tiles, float deltaTime);
+    // Steps toward the player, along flowField when there is one, while
+    // within maxDistance; each axis is blocked by walls separately.
+    void MoveSmart(float* x, float* y, const float* speed, const float* maxDistance,
+                   const uint8_t* dying, int count, float playerX, float playerY,
+                   const FlowField* flowField, const TileCollisionView& tiles, float deltaTime);
+}
+
+#endif // ENEMY_POOL_H
@@ -0,0 +1,70 @@
+//EnemyRender.cpp
+
+#include "EnemyRender.h"
+#include "SpriteBatch.h"
+#include <SDL2/SDL.h>
+
+namespace EnemyRender {
+
+namespace {
+
+struct TypeLook {
+    SpriteId sprite;
+    Uint8 r, g, b;
+};
+
+// indexed by Enemy::EnemyType
+const TypeLook typeLooks[Enemy::typeCount] = {
+    {SPRITE_ENEMY_HORIZONTAL, 90, 252, 45},
+    {SPRITE_ENEMY_VERTICAL, 49, 90, 255},
+    {SPRITE_ENEMY_SMART, 194, 45, 252},
+};
+
+void DrawAlive(const EnemyPool& enemies, int index, const TypeLook& look, const SDL_Rect& enemyRect, SpriteBatch& batch) {
+    float healthPercent = (float)enemies.GetHP(index) / enemies.GetMaxHP(index);
+    Uint8 r = look.r * healthPercent;
+    Uint8 g = look.g * healthPercent;
+    Uint8 b = look.b * healthPercent;
+    SDL_Color tint = {r, g, b, 255};
+    if (!batch.AddSprite(look.sprite, enemyRect, tint, SpriteBatch::LAYER_ACTORS)) {
+        batch.AddRect(enemyRect, tint, SpriteBatch::LAYER_ACTORS);
+    }
+}
+
+void DrawDeathEffect(const EnemyPool& enemies, int index, const TypeLook& look, const SDL_Rect& enemyRect, SpriteBatch& batch) {
+    float progress = enemies.GetDeathProgress(index);
+    int expandedSize = (int)(enemyRect.w * (1.0f + 0.7f * progress));
+    int centerX = (int)(enemyRect.x + enemyRect.w * 0.5f);
+    int centerY = (int)(enemyRect.y + enemyRect.h * 0.5f);
+    SDL_Rect deathRect = {
+        centerX - expandedSize / 2,
+        centerY - expandedSize / 2,
+        expandedSize,
+        expandedSize
+    };
+    Uint8 alpha = (Uint8)(255.0f * (1.0f - progress));
+    batch.AddRect(deathRect, SDL_Color{look.r, look.g, look.b, alpha}, SpriteBatch::LAYER_EFFECTS);
+}
+}
+
+void Draw(const EnemyPool& enemies, float cameraX, float cameraY, SpriteBatch& batch, float alpha) {
+    for (int t = 0; t < Enemy::typeCount; t++) {
+        Enemy::EnemyType type = (Enemy::EnemyType)t;
+        const TypeLook& look = typeLooks[t];
+        for (int i = enemies.GetTypeBegin(type); i < enemies.GetTypeEnd(type); i++) {
+            Entity body = enemies.GetBody(i);
+            SDL_Rect enemyRect = {
+                (int)(enemies.GetInterpolatedX(i, alpha) - cameraX),
+                (int)(enemies.GetInterpolatedY(i, alpha) - cameraY),
+                (int)body.width, (int)body.height
+            };
+            if (enemies.IsDying(i)) {
+                DrawDeathEffect(enemies, i, look, enemyRect, batch);
+            } else {
+                DrawAlive(enemies, i, look, enemyRect, batch);
+            }
+        }
+    }
+}
+
+}
@@ -0,0 +1,17 @@
+// EnemyRender.h
+#ifndef ENEMY_RENDER_H
+#define ENEMY_RENDER_H
+
+#include "EnemyPool.h"
+
+class SpriteBatch;
+
+namespace EnemyRender {
+
+// Live enemies as tinted sprites, dying ones as their fading death burst.
+// Sprite and colour are picked per type here, so the pool stores neither.
+void Draw(const EnemyPool& enemies, float cameraX, float cameraY, SpriteBatch& batch, float alpha = 1.0f);
+
+}
+
+#endif // ENEMY_RENDER_H
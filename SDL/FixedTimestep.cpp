@@ -0,0 +1,58 @@
+// FixedTimestep.cpp
+
+#include "FixedTimestep.h"
+#include <cmath>
+
+FixedTimestep::FixedTimestep(float tickRate, int maxStepsPerFrame)
+    : stepSize(1.0f / tickRate), accumulator(0.0f), maxStepsPerFrame(maxStepsPerFrame), stepsThisFrame(0) {
+}
+
+void FixedTimestep::SetTickRate(float tickRate) {
+    if (tickRate <= 0.0f) {
+        return;
+    }
+    stepSize = 1.0f / tickRate;
+    accumulator = 0.0f;
+}
+
+float FixedTimestep::GetStepSize() const {
+    return stepSize;
+}
+
+void FixedTimestep::Accumulate(float frameTime) {
+    if (frameTime < 0.0f) {
+        frameTime = 0.0f;
+    }
+    // After a hitch, only catch up a bounded number of steps instead of spiralling
+    float maxFrameTime = stepSize * maxStepsPerFrame;
+    if (frameTime > maxFrameTime) {
+        frameTime = maxFrameTime;
+    }
+    accumulator += frameTime;
+    stepsThisFrame = 0;
+}
+
+bool FixedTimestep::ConsumeStep() {
+    if (accumulator < stepSize) {
+        return false;
+    }
+    if (stepsThisFrame >= maxStepsPerFrame) {
+        // drop whatever is left over so the next frame starts fresh
+        accumulator = std::fmod(accumulator, stepSize);
+        return false;
+    }
+    accumulator -= stepSize;
+    stepsThisFrame++;
+    return true;
+}
+
+float FixedTimestep::GetAlpha() const {
+    float alpha = accumulator / stepSize;
+    if (alpha > 1.0f) alpha = 1.0f;
+    return alpha;
+}
+
+void FixedTimestep::Reset() {
+    accumulator = 0.0f;
+    stepsThisFrame = 0;
+}
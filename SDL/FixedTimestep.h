@@ -0,0 +1,28 @@
+// FixedTimestep.h
+#ifndef FIXED_TIMESTEP_H
+#define FIXED_TIMESTEP_H
+
+#include "Config.h"
+
+// Accumulates real frame time and hands it out as fixed-size simulation steps.
+// The leftover fraction is exposed as an interpolation factor for rendering.
+class FixedTimestep {
+    public:
+        FixedTimestep(float tickRate = SIM_TICK_RATE, int maxStepsPerFrame = MAX_SIM_STEPS_PER_FRAME);
+
+        void SetTickRate(float tickRate);
+        float GetStepSize() const;
+
+        void Accumulate(float frameTime);
+        bool ConsumeStep();
+        float GetAlpha() const;
+        void Reset();
+
+    private:
+        float stepSize;
+        float accumulator;
+        int maxStepsPerFrame;
+        int stepsThisFrame;
+};
+
+#endif // FIXED_TIMESTEP_H
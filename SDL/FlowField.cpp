@@ -0,0 +1,142 @@
+// FlowField.cpp
+
+#include "FlowField.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+// straight neighbours first so ties prefer them over diagonals
+const int neighbourX[8] = { 1, -1, 0, 0, 1, 1, -1, -1 };
+const int neighbourY[8] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+}
+
+FlowField::FlowField()
+    : originX(0), originY(0), width(0), height(0), tileSize(1), goalTileX(-1), goalTileY(-1) {
+}
+
+void FlowField::Build(const TileCollisionView& tiles, int goalX, int goalY, int radius) {
+    // Clamp the search window to the map
+    originX = std::max(0, goalX - radius);
+    originY = std::max(0, goalY - radius);
+    width = std::max(0, std::min(tiles.GetWidth(), goalX + radius + 1) - originX);
+    height = std::max(0, std::min(tiles.GetHeight(), goalY + radius + 1) - originY);
+    tileSize = tiles.tileSize;
+    goalTileX = goalX;
+    goalTileY = goalY;
+    distance.assign(std::max(1, width * height), -1);
+    nextTile.assign(std::max(1, width * height), -1);
+    frontier.clear();
+
+    if (goalX < originX || goalX >= originX + width || goalY < originY || goalY >= originY + height) {
+        return;
+    }
+
+    // BFS distances over 4-connected open tiles, x/y below are window coordinates
+    int goalIndex = (goalY - originY) * width + (goalX - originX);
+    distance[goalIndex] = 0;
+    frontier.push_back(goalIndex);
+    for (size_t head = 0; head < frontier.size(); head++) {
+        int index = frontier[head];
+        int x = index % width;
+        int y = index / width;
+        for (int n = 0; n < 4; n++) {
+            int nx = x + neighbourX[n];
+            int ny = y + neighbourY[n];
+            if (nx < 0 || nx >= width || ny < 0 || ny >= height ||
+                tiles.IsSolidTile(originX + nx, originY + ny)) {
+                continue;
+            }
+            int nIndex = ny * width + nx;
+            if (distance[nIndex] < 0) {
+                distance[nIndex] = distance[index] + 1;
+                frontier.push_back(nIndex);
+            }
+        }
+    }
+
+    // Each reached tile points at its closest neighbour; diagonals only when
+    // both side tiles are open so chasers never clip a wall corner
+    for (int index : frontier) {
+        if (index == goalIndex) {
+            continue;
+        }
+        int x = index % width;
+        int y = index / width;
+        int best = -1;
+        int bestDistance = distance[index];
+        for (int n = 0; n < 8; n++) {
+            int nx = x + neighbourX[n];
+            int ny = y + neighbourY[n];
+            if (nx < 0 || nx >= width || ny < 0 || ny >= height) {
+                continue;
+            }
+            int nIndex = ny * width + nx;
+            if (distance[nIndex] < 0 || distance[nIndex] >= bestDistance) {
+                continue;
+            }
+            if (n >= 4 && (tiles.IsSolidTile(originX + nx, originY + y) ||
+                           tiles.IsSolidTile(originX + x, originY + ny))) {
+                continue;
+            }
+            best = nIndex;
+            bestDistance = distance[nIndex];
+        }
+        nextTile[index] = best;
+    }
+}
+
+void FlowField::Clear() {
+    distance.clear();
+    nextTile.clear();
+    frontier.clear();
+    goalTileX = -1;
+    goalTileY = -1;
+}
+
+bool FlowField::IsBuilt() const {
+    return !distance.empty();
+}
+
+int FlowField::GetGoalTileX() const {
+    return goalTileX;
+}
+
+int FlowField::GetGoalTileY() const {
+    return goalTileY;
+}
+
+int FlowField::GetDistance(int tileX, int tileY) const {
+    tileX -= originX;
+    tileY -= originY;
+    if (!IsBuilt() || tileX < 0 || tileX >= width || tileY < 0 || tileY >= height) {
+        return -1;
+    }
+    return distance[tileY * width + tileX];
+}
+
+bool FlowField::Steer(float worldX, float worldY, float& dirX, float& dirY) const {
+    if (!IsBuilt()) {
+        return false;
+    }
+    int tileX = (int)std::floor(worldX / tileSize) - originX;
+    int tileY = (int)std::floor(worldY / tileSize) - originY;
+    if (tileX < 0 || tileX >= width || tileY < 0 || tileY >= height) {
+        return false;
+    }
+    int next = nextTile[tileY * width + tileX];
+    if (next < 0) {
+        return false;
+    }
+
+    float targetX = (originX + next % width + 0.5f) * tileSize;
+    float targetY = (originY + next / width + 0.5f) * tileSize;
+    float dx = targetX - worldX;
+    float dy = targetY - worldY;
+    float length = std::sqrt(dx * dx + dy * dy);
+    if (length <= 0.0f) {
+        return false;
+    }
+    dirX = dx / length;
+    dirY = dy / length;
+    return true;
+}
@@ -0,0 +1,45 @@
+// FlowField.h
+#ifndef FLOW_FIELD_H
+#define FLOW_FIELD_H
+
+#include <vector>
+#include "Config.h"
+#include "TileCollisionView.h"
+
+// Shortest-path directions from open tiles toward one goal tile.
+// Built once with a BFS over the map and then sampled by any number of
+// chasers in O(1), so pathing cost does not grow with enemy count.
+// Only a square window around the goal is searched, so the cost of a
+// rebuild stays bounded on large maps; outside it there is no direction.
+class FlowField {
+    public:
+        FlowField();
+
+        void Build(const TileCollisionView& tiles, int goalTileX, int goalTileY, int radius = CHASE_FIELD_RADIUS);
+        void Clear();
+        bool IsBuilt() const;
+        int GetGoalTileX() const;
+        int GetGoalTileY() const;
+
+        // Steps from the tile to the goal, or -1 if it cannot be reached
+        int GetDistance(int tileX, int tileY) const;
+
+        // Unit direction from a world point toward the center of the next tile on
+        // its path. False on the goal tile or anywhere the field has no path.
+        bool Steer(float worldX, float worldY, float& dirX, float& dirY) const;
+
+    private:
+        // window of the map the field covers, in tiles
+        int originX;
+        int originY;
+        int width;
+        int height;
+        int tileSize;
+        int goalTileX;
+        int goalTileY;
+        std::vector<int> distance;
+        std::vector<int> nextTile; // window index of the neighbour to move to, -1 for none
+        std::vector<int> frontier; // BFS queue, kept to avoid reallocating each build
+};
+
+#endif // FLOW_FIELD_H
@@ -0,0 +1,49 @@
+// FrameSnapshot.cpp
+
+#include "FrameSnapshot.h"
+
+void FrameSnapshot::CaptureWorld(const World& world) {
+    player = world.GetPlayer();
+    previousPlayer = world.GetPreviousPlayer();
+    playerHP = world.GetPlayerHP();
+    playerMaxHP = world.GetPlayerMaxHP();
+    playerInvulnTimer = world.GetPlayerInvulnTimer();
+    playerDying = world.IsPlayerDying();
+    playerDeathProgress = world.GetPlayerDeathProgress();
+    playerWeapons = world.GetPlayerWeapons();
+    currentWeaponIndex = world.GetCurrentWeaponIndex();
+
+    // plain assignment keeps each vector's capacity, so warm slots don't
+    // allocate; matching the world's capacity first means a slot grows once
+    // when the world's storage does, not each time a count reaches a new high
+    enemies.Reserve(world.GetEnemies().Capacity());
+    enemies = world.GetEnemies();
+    bullets.Reserve(world.GetBullets().Capacity());
+    bullets = world.GetBullets();
+    healthItems.reserve(world.GetHealthItems().capacity());
+    healthItems = world.GetHealthItems();
+    speedItems.reserve(world.GetSpeedItems().capacity());
+    speedItems = world.GetSpeedItems();
+    weaponItems.reserve(world.GetWeaponItems().capacity());
+    weaponItems = world.GetWeaponItems();
+    wallBreakEffects.reserve(world.GetWallBreakEffects().capacity());
+    wallBreakEffects = world.GetWallBreakEffects();
+    breakingWallDuration = world.GetBreakingWallDuration();
+
+    level = world.GetLevel();
+    levelTimer = world.GetLevelTimer();
+    score = world.GetScore();
+
+    mapWidth = world.GetMapWidth();
+    mapHeight = world.GetMapHeight();
+    mapRevision = world.GetMapRevision();
+}
+
+float FrameSnapshot::GetRenderAlpha(std::chrono::steady_clock::time_point now) const {
+    if (status != World::RUNNING || inputEnded || stepSize <= 0.0f) {
+        return 1.0f;
+    }
+    float elapsed = std::chrono::duration<float>(now - publishTime).count();
+    float renderAlpha = alpha + elapsed / stepSize;
+    return renderAlpha > 1.0f ? 1.0f : renderAlpha;
+}
@@ -0,0 +1,80 @@
+// FrameSnapshot.h
+#ifndef FRAME_SNAPSHOT_H
+#define FRAME_SNAPSHOT_H
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "Entity.h"
+#include "Weapon.h"
+#include "Items.h"
+#include "InputFrame.h"
+#include "EnemyPool.h"
+#include "BulletPool.h"
+#include "World.h"
+#include "Arena.h"
+
+// Everything the renderer and HUD read about the world after one batch of
+// ticks, copied out so drawing never touches the World the simulation is
+// stepping. SimRunner fills these; Game only reads them.
+struct FrameSnapshot {
+    // a tile changed by a tick; serials only grow, so the reader can skip
+    // edits it already applied when a later snapshot repeats them
+    struct TileEdit {
+        int x, y;
+        int type;
+        int hp;
+        std::uint64_t serial;
+    };
+
+    // ====== Timing ======
+    World::Status status = World::RUNNING;
+    bool inputEnded = false; // the input source ran dry and the runner parked
+    std::uint64_t tick = 0;  // ticks run by the runner so far
+    float stepSize = 0.0f;
+    float alpha = 1.0f;      // fraction of a step left over when this was published
+    std::chrono::steady_clock::time_point publishTime;
+
+    // ====== Player ======
+    Entity player;
+    Entity previousPlayer;
+    int playerHP = 0;
+    int playerMaxHP = 1;
+    float playerInvulnTimer = 0.0f;
+    bool playerDying = false;
+    float playerDeathProgress = 0.0f;
+    std::vector<Weapon> playerWeapons;
+    int currentWeaponIndex = 0;
+    InputFrame lastInput;   // input of the last tick
+    int shotCount = 0;      // ticks that fired, since the runner was made
+    float lastShotDirX = 1.0f;
+    float lastShotDirY = 0.0f;
+
+    // ====== Entities ======
+    EnemyPool enemies;
+    BulletPool bullets;
+    ArenaVector<HealthItem> healthItems; // heap backed, like every copy of arena storage
+    ArenaVector<SpeedItem> speedItems;
+    ArenaVector<WeaponItem> weaponItems;
+    ArenaVector<World::WallBreakEffect> wallBreakEffects;
+    float breakingWallDuration = 1.0f;
+
+    // ====== HUD ======
+    int level = 1;
+    float levelTimer = 0.0f;
+    int score = 0;
+
+    // ====== Map ======
+    int mapWidth = 0;
+    int mapHeight = 0;
+    int mapRevision = 0;
+    std::vector<TileEdit> tileEdits; // every edit the reader hasn't acknowledged yet
+
+    // Copies the world's state; the timing, input and tile edit fields are the runner's to fill
+    void CaptureWorld(const World& world);
+    // Interpolation factor for drawing at time now, counting the steps that
+    // have come due since publishing; 1 once the world has stopped
+    float GetRenderAlpha(std::chrono::steady_clock::time_point now) const;
+};
+
+#endif // FRAME_SNAPSHOT_H
@@ -0,0 +1,140 @@
+//FreeTileIndex.cpp
+
+#include <algorithm>
+#include <bit>
+#include "FreeTileIndex.h"
+
+void FreeTileIndex::Build(const TileMap& map) {
+    width = map.GetWidth();
+    height = map.GetHeight();
+    int tiles = width * height;
+    int words = (tiles + 63) / 64;
+    bits.assign(words, 0);
+    count = 0;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            if (!map.IsSolid(x, y)) {
+                int index = y * width + x;
+                bits[index >> 6] |= std::uint64_t(1) << (index & 63);
+                count++;
+            }
+        }
+    }
+
+    // linear-time Fenwick build: each node pushes its sum to its parent.
+    // Sized to a power of two so Get's descent needs no bounds checks.
+    int treeWords = (int)std::bit_ceil((unsigned)std::max(words, 1));
+    tree.assign(treeWords + 1, 0);
+    for (int i = 1; i <= treeWords; i++) {
+        if (i <= words) {
+            tree[i] += std::popcount(bits[i - 1]);
+        }
+        int parent = i + (i & -i);
+        if (parent <= treeWords) {
+            tree[parent] += tree[i];
+        }
+    }
+}
+
+void FreeTileIndex::Add(int x, int y) {
+    if (x >= 0 && x < width && y >= 0 && y < height) {
+        Set(y * width + x, true);
+    }
+}
+
+void FreeTileIndex::Remove(int x, int y) {
+    if (x >= 0 && x < width && y >= 0 && y < height) {
+        Set(y * width + x, false);
+    }
+}
+
+bool FreeTileIndex::Contains(int x, int y) const {
+    if (x < 0 || x >= width || y < 0 || y >= height) {
+        return false;
+    }
+    int index = y * width + x;
+    return (bits[index >> 6] >> (index & 63)) & 1;
+}
+
+int FreeTileIndex::GetCount() const {
+    return count;
+}
+
+void FreeTileIndex::Set(int index, bool free) {
+    std::uint64_t mask = std::uint64_t(1) << (index & 63);
+    std::uint64_t& word = bits[index >> 6];
+    if (((word & mask) != 0) == free) {
+        return;
+    }
+    word ^= mask;
+    count += free ? 1 : -1;
+    AddToTree(index >> 6, free ? 1 : -1);
+}
+
+void FreeTileIndex::AddToTree(int word, int delta) {
+    for (int i = word + 1; i < (int)tree.size(); i += i & -i) {
+        tree[i] += delta;
+    }
+}
+
+// Both searches below select with masks instead of branching; the direction
+// taken at each level is random, so branches would mispredict.
+void FreeTileIndex::Get(int k, int& x, int& y) const {
+    // descend the Fenwick tree to the word holding the k-th set bit
+    int position = 0;
+    int remaining = k;
+    for (int step = (int)tree.size() - 1; step > 0; step >>= 1) {
+        int below = tree[position + step];
+        int take = -(int)(below <= remaining); // all ones or zero
+        position += step & take;
+        remaining -= below & take;
+    }
+
+    // then halve the word until the k-th set bit is pinned down
+    std::uint64_t word = bits[position];
+    int bit = 0;
+    for (int half = 32; half > 0; half >>= 1) {
+        int lowCount = std::popcount(word & ((std::uint64_t(1) << half) - 1));
+        int upper = -(int)(remaining >= lowCount);
+        remaining -= lowCount & upper;
+        word >>= half & upper; // the low half's bits are skipped by the count, not cleared
+        bit += half & upper;
+    }
+    int index = position * 64 + bit;
+    x = index % width;
+    y = index / width;
+}
+
+bool FreeTileIndex::FarEnough(int index, int tileSize, float avoidX, float avoidY, float minDistance) const {
+    float dx = (float)((index % width) * tileSize) - avoidX;
+    float dy = (float)((index / width) * tileSize) - avoidY;
+    return dx * dx + dy * dy >= minDistance * minDistance;
+}
+
+bool FreeTileIndex::Pick(Rng& rng, int tileSize, float avoidX, float avoidY, float minDistance, int& x, int& y) const {
+    if (count == 0) {
+        return false;
+    }
+    for (int attempt = 0; attempt < randomTries; attempt++) {
+        Get(rng.NextInt(count), x, y);
+        if (FarEnough(y * width + x, tileSize, avoidX, avoidY, minDistance)) {
+            return true;
+        }
+    }
+
+    // nearly every free tile is close by: take the first far one from a random start
+    int words = (int)bits.size();
+    int start = rng.NextInt(words);
+    for (int offset = 0; offset < words; offset++) {
+        int w = (start + offset) % words;
+        for (std::uint64_t word = bits[w]; word != 0; word &= word - 1) {
+            int index = w * 64 + std::countr_zero(word);
+            if (FarEnough(index, tileSize, avoidX, avoidY, minDistance)) {
+                x = index % width;
+                y = index / width;
+                return true;
+            }
+        }
+    }
+    return false;
+}
@@ -0,0 +1,47 @@
+// FreeTileIndex.h
+#ifndef FREE_TILE_INDEX_H
+#define FREE_TILE_INDEX_H
+
+#include <cstdint>
+#include <vector>
+#include "TileMap.h"
+#include "Rng.h"
+
+// The map's walkable tiles as one bit per tile, with a Fenwick tree of
+// per-word counts so the k-th free tile is found in O(log tiles). Spawning
+// draws uniformly from the free tiles instead of retrying random points until
+// one misses the walls. About 1.1 bits per tile, so it scales to the largest
+// maps. Kept current with Add/Remove as walls break.
+class FreeTileIndex {
+    public:
+        static constexpr int randomTries = 16; // uniform draws before the bounded scan
+
+        void Build(const TileMap& map);
+        void Add(int x, int y);    // tile became walkable
+        void Remove(int x, int y); // tile became solid, or is taken for this batch
+        bool Contains(int x, int y) const;
+        int GetCount() const;
+        int GetWidth() const { return width; }
+        int GetHeight() const { return height; }
+
+        void Get(int k, int& x, int& y) const; // k-th free tile in row-major order, k < GetCount()
+
+        // Picks a free tile whose top-left corner, in pixels, is at least
+        // minDistance from (avoidX, avoidY). A few uniform draws, then one
+        // scan from a random word, so the worst case is a single pass over
+        // the index. False when no free tile qualifies.
+        bool Pick(Rng& rng, int tileSize, float avoidX, float avoidY, float minDistance, int& x, int& y) const;
+
+    private:
+        int width = 0;
+        int height = 0;
+        int count = 0;
+        std::vector<std::uint64_t> bits;   // bit (i & 63) of word i >> 6 is tile i = y * width + x
+        std::vector<int> tree;             // Fenwick tree over popcount(bits[w]), 1-based
+
+        void Set(int index, bool free);
+        void AddToTree(int word, int delta);
+        bool FarEnough(int index, int tileSize, float avoidX, float avoidY, float minDistance) const;
+};
+
+#endif // FREE_TILE_INDEX_H
@@ -4,17 +4,19 @@
 #include <cmath>
 #include <vector>
 #include <algorithm>
+#include <chrono>
 #include "Game.h"
 #include "Enemy.h"
+#include "EnemyRender.h"
 #include "Entity.h"
 #include "Config.h"
+#include "AllocTracker.h"
 #include "Menu.h"  
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_image.h>
 #include <SDL2/SDL_ttf.h>
 #include "Weapon.h"
-#include "CombatSystem.h"
-#include "SpawnSystem.h"
+#include "Profiler.h"
 #include <fstream>
 #include <iostream>
 #include <vector>
@@ -23,37 +25,6 @@
 #define SPRITE_SIZE 32
 
 namespace {
-SDL_Texture* LoadTextureWithFallback(SDL_Renderer* renderer, const std::string& relativePath) {
-    std::vector<std::string> candidatePaths = {
-        relativePath,
-        "SDL/" + relativePath,
-        "../" + relativePath,
-        "../../SDL/" + relativePath
-    };
-
-    char* basePathRaw = SDL_GetBasePath();
-    if (basePathRaw) {
-        std::string basePath(basePathRaw);
-        candidatePaths.push_back(basePath + relativePath);
-        candidatePaths.push_back(basePath + "../" + relativePath);
-        candidatePaths.push_back(basePath + "../SDL/" + relativePath);
-        SDL_free(basePathRaw);
-    }
-
-    for (const std::string& path : candidatePaths) {
-        SDL_Texture* texture = IMG_LoadTexture(renderer, path.c_str());
-        if (texture) {
-            return texture;
-        }
-    }
-
-    std::cout << "Failed texture paths for " << relativePath << ":" << std::endl;
-    for (const std::string& path : candidatePaths) {
-        std::cout << "  - " << path << std::endl;
-    }
-    return nullptr;
-}
-
 void GetLogicalMousePosition(SDL_Renderer* renderer, int& mouseX, int& mouseY) {
     int windowMouseX = 0;
     int windowMouseY = 0;
@@ -68,50 +39,33 @@ void GetLogicalMousePosition(SDL_Renderer* renderer, int& mouseX, int& mouseY) {
 }
 
 // ---------------- Constructor ----------------
-Game::Game() {
+Game::Game() : simRunner(world) {
     running = false;
     lastTime = 0;
+    vsyncEnabled = false;
+    frameRateCap = 0;
+    lastFrameCounter = 0;
+    showRenderStats = false;
+    showAssetTimings = false;
+    useAssetPack = true;
+    showProfiler = false;
+    mapLayerRevision = -1;
+    renderAlpha = 1.0f;
+    simThreadEnabled = true;
+    frame = &simRunner.AcquireSnapshot();
+    seenShotCount = 0;
+    appliedTileSerial = 0;
+    recording = false;
+    replaying = false;
+    replayEndReason = "finished";
+    loggedRunStarted = false;
+    replayCursor = 0;
     window = nullptr;
     renderer = nullptr;
-    playerTexture = nullptr;
-    playerWalkTexture1 = nullptr;
-    playerWalkTexture2 = nullptr;
-    playerPistolTexture = nullptr;
-    playerShotgunTexture = nullptr;
-    playerSmgTexture = nullptr;
-    playerPistolWalkTexture1 = nullptr;
-    playerPistolWalkTexture2 = nullptr;
-    playerShotgunWalkTexture1 = nullptr;
-    playerShotgunWalkTexture2 = nullptr;
-    playerSmgWalkTexture1 = nullptr;
-    playerSmgWalkTexture2 = nullptr;
-    inventoryPistolTexture = nullptr;
-    inventoryShotgunTexture = nullptr;
-    inventorySmgTexture = nullptr;
-    wallTexture = nullptr;
-    floorTexture = nullptr;
-    healthTexture = nullptr;
-    brokenWallTexture = nullptr;
-    speedTexture = nullptr;
-    weaponItemsTexture = nullptr;
     currentState = MENU;
     previousState = currentState;
-    currentLevel = 1;
-    playerHP = 30;
-    playerMaxHP = 30;
-    playerInvulnTimer = 0.0f;
-    playerBaseSpeed = BASE_PLAYER_SPEED;
-    playerSpeed = playerBaseSpeed;
-    speedItemAmount = 50.0f;
-    speedItemDuration = 5.0f;
-    speedItemTimer = 0.0f;
-    speedItemActive = false;
-    shootCooldown = 0.0f;
     screenHeight = 600;
     screenWidth = 800;
-    levelTimer = 100.0f;
-    bonusTime = 0;
-    score = 0;
     highScore = 0;
     highScoreResetInGameOver = false;
     shootAnimTimer = 0.0f;
@@ -123,68 +77,19 @@ Game::Game() {
     playerWalkAnimTimer = 0.0f;
     playerWalkFrameDuration = 0.14f;
     playerWalkFrameIndex = 0;
-    playerDying = false;
-    playerDeathTimer = 0.0f;
-    playerDeathDuration = 0.6f;
-    breakingWallDuration = 0.6f;
     LoadHighScore();
     cameraX = screenWidth / 2;
     cameraY = screenHeight / 2;
-    player.x = screenWidth / 2;
-    player.y = screenHeight / 2;
-    player.width = PLAYER_SIZE;
-    player.height = PLAYER_SIZE;
-    tileSize = TILE_SIZE;
-    playerMeleeDamage = 25;
-
-    int playerTileX = (int)((player.x + player.width * 0.5f) / tileSize);
-    int playerTileY = (int)((player.y + player.height * 0.5f) / tileSize);
-    
-    srand(time(nullptr)); // set rand before using it in map
-    //map
-    for(int y = 0; y < mapHeight; y++) {
-        for(int x = 0; x < mapWidth; x++) {
-            bool nearPlayerSpawn = std::abs(x - playerTileX) <= 1 && std::abs(y - playerTileY) <= 1;
-
-            if(x == 0 || y == 0 || x == mapWidth-1 || y == mapHeight-1) {
-                map[y * mapWidth + x] = 1; // border wall
-                tileHP[y*mapWidth + x] = 0;
-            }
-            else if(!nearPlayerSpawn && rand() % 10 == 0) {
-                map[y * mapWidth + x] = 2; // random wall
-                tileHP[y*mapWidth + x] = 0;
-            }
-            else if(!nearPlayerSpawn && rand() % 7 == 0) {      
-                map[y * mapWidth + x] = 3; // obstructable objects like a wall.
-                tileHP[y*mapWidth + x] = 40;
-            } else {
-                map[y * mapWidth + x] = 0; // floor
-                tileHP[y*mapWidth + x] = 0;
-            }
-        }
-    }
-    //enemies
-    SpawnSystem::SpawnEnemies(
-        5,
-        enemies,
-        player,
-        currentLevel,
-        mapWidth,
-        mapHeight,
-        tileSize,
-        [this](const Entity& ent, float x, float y) {
-            return DetectCollision(ent, x, y);
-        },
-        GetDifficultyMultiplier()
-    );
-
-    //weapons
-    playerWeapons.push_back(Weapon(Weapon::PISTOL));
-    currentWeaponIndex = 0;
+    tileSize = world.GetTileSize();
+    threadCount = 0;
+
+    world.SetSeed((std::uint64_t)time(nullptr)); // --seed replaces this for reproducible runs
+    world.GenerateMap(screenWidth / 2, screenHeight / 2);
+    world.SpawnEnemies(5, GetDifficultyMultiplier());
 }
 
 int Game::getLevel() {
-    return currentLevel;
+    return world.GetLevel();
 }
 
 Uint32 Game::getLastTime() {
@@ -198,6 +103,96 @@ float Game::getDeltaTime() {
     return deltaTime;
 }
 
+void Game::SetTickRate(float ticksPerSecond) {
+    simRunner.SetTickRate(ticksPerSecond);
+}
+
+void Game::SetVSync(bool enabled) {
+    vsyncEnabled = enabled;
+}
+
+void Game::SetFrameRateCap(int framesPerSecond) {
+    frameRateCap = framesPerSecond;
+}
+
+void Game::SetMapSize(int mapWidth, int mapHeight) {
+    world.SetMapSize(mapWidth, mapHeight);
+    world.GenerateMap(screenWidth / 2, screenHeight / 2);
+    world.Restart(GetDifficultyMultiplier());
+}
+
+void Game::SetSeed(std::uint64_t seed) {
+    world.SetSeed(seed);
+    world.GenerateMap(screenWidth / 2, screenHeight / 2);
+    world.Restart(GetDifficultyMultiplier());
+}
+
+void Game::SetThreadCount(int threads) {
+    threadCount = threads;
+}
+
+void Game::SetSimThread(bool enabled) {
+    simThreadEnabled = enabled;
+}
+
+void Game::SetRecordPath(const char* path) {
+    recordPath = path;
+    recording = true;
+    replaying = false;
+}
+
+bool Game::SetReplayPath(const char* path) {
+    if (!inputLog.Load(path)) {
+        printf("Could not load replay %s\n", path);
+        return false;
+    }
+    replaying = true;
+    recording = false;
+    currentState = PLAYING; // no menus in a replay
+    return true;
+}
+
+void Game::SetMapCaching(bool enabled) {
+    mapLayer.SetCachingEnabled(enabled);
+}
+
+void Game::SetShowRenderStats(bool enabled) {
+    showRenderStats = enabled;
+}
+
+void Game::SetShowAssetTimings(bool enabled) {
+    showAssetTimings = enabled;
+}
+
+void Game::SetUseAssetPack(bool enabled) {
+    useAssetPack = enabled;
+}
+
+void Game::SetProfileCsvPath(const char* path) {
+    profileCsvPath = path;
+}
+
+void Game::SetTracePath(const char* path) {
+    tracePath = path;
+    Tracer::Get().Start();
+}
+
+void Game::LimitFrameRate() {
+    if (frameRateCap <= 0) {
+        return;
+    }
+    Uint64 frequency = SDL_GetPerformanceFrequency();
+    Uint64 targetTicks = frequency / frameRateCap;
+    Uint64 elapsed = SDL_GetPerformanceCounter() - lastFrameCounter;
+    if (elapsed < targetTicks) {
+        Uint32 sleepMs = (Uint32)((targetTicks - elapsed) * 1000 / frequency);
+        if (sleepMs > 0) {
+            SDL_Delay(sleepMs);
+        }
+    }
+    lastFrameCounter = SDL_GetPerformanceCounter();
+}
+
 float Game::GetDifficultyMultiplier() const {
     if (currentDifficulty == EASY) return 0.8f;
     if (currentDifficulty == MEDIUM) return 1.0f;
@@ -210,113 +205,55 @@ Game::GameState Game::getCurrentState() {
 }
 
 void Game::DrawMap() {
-    int startX = cameraX / tileSize;
-    int startY = cameraY / tileSize;
-    int endX = (cameraX + screenWidth) / tileSize + 1;
-    int endY = (cameraY + screenHeight) / tileSize + 1;
-    for(int y = startY; y < endY; y++)
-        for(int x = startX; x < endX; x++)
-            DrawTile(x, y);
+    PROFILE_SCOPE("Render.Map");
+    mapLayer.Draw(renderer, renderMap, tileSize, cameraX, cameraY, screenWidth, screenHeight);
 };
 
-void Game::DrawTile(int x, int y) {
-    if (x < 0 || x >= mapWidth || y < 0 || y >= mapHeight)
+void Game::SyncRenderMap() {
+    const TileMap& map = world.GetTileMap();
+    if (world.GetMapRevision() != mapLayerRevision) {
+        renderMap = map;
+        mapLayer.Invalidate();
+        mapLayerRevision = world.GetMapRevision();
         return;
-    int tile = map[y * mapWidth + x];
-    if (tile == 1) {
-        // border wall
-        SDL_Rect rect = {x*tileSize - cameraX, y*tileSize - cameraY, tileSize, tileSize};
-        if (wallTexture) {
-            SDL_RenderCopy(renderer, wallTexture, nullptr, &rect);
-        } else {
-            SDL_SetRenderDrawColor(renderer, 80, 90, 110, 255);
-            SDL_RenderFillRect(renderer, &rect);
-        }
     }
-    if (tile == 0) {
-        // floor
-        SDL_Rect rect = {x*tileSize - cameraX, y*tileSize - cameraY, tileSize, tileSize};
-        if (floorTexture) {
-            static SDL_Texture* cachedFloorTexture = nullptr;
-            static SDL_Rect cachedSrcRect = {0, 0, 0, 0};
-            if (cachedFloorTexture != floorTexture) {
-                int texW = 0;
-                int texH = 0;
-                SDL_QueryTexture(floorTexture, nullptr, nullptr, &texW, &texH);
-                cachedSrcRect = {0, 0, texW, texH};
-                if (texW > 2 && texH > 2) {
-                    cachedSrcRect = {1, 1, texW - 2, texH - 2};
-                }
-                cachedFloorTexture = floorTexture;
+    // Same map: patch tiles whose edits were still in flight when the runner parked
+    for (int y = 0; y < map.GetHeight(); y++) {
+        for (int x = 0; x < map.GetWidth(); x++) {
+            if (renderMap.GetType(x, y) != map.GetType(x, y) || renderMap.GetHP(x, y) != map.GetHP(x, y)) {
+                renderMap.SetTile(x, y, map.GetType(x, y), map.GetHP(x, y));
+                mapLayer.MarkTileDirty(x, y);
             }
-            SDL_RenderCopy(renderer, floorTexture, &cachedSrcRect, &rect);
-        } else {
-            SDL_SetRenderDrawColor(renderer, 60, 55, 50, 255); // floor fallback
-            SDL_RenderFillRect(renderer, &rect);
-        }
-    }
-    if (tile == 2) {
-        // render random objects
-        SDL_Rect rect = {x*tileSize - cameraX, y*tileSize - cameraY, tileSize, tileSize};
-        if (wallTexture) {
-            SDL_RenderCopy(renderer, wallTexture, nullptr, &rect);
-        } else {
-            SDL_SetRenderDrawColor(renderer, 80, 90, 110, 255); //wall fallback
-            SDL_RenderFillRect(renderer, &rect);
-        }
-    }
-    if (tile == 3) {
-        // render obstructable objects
-        SDL_Rect rect = {x*tileSize - cameraX, y*tileSize - cameraY, tileSize, tileSize};
-        if (brokenWallTexture) {
-            SDL_RenderCopy(renderer, brokenWallTexture, nullptr, &rect);
-        } else {
-            SDL_SetRenderDrawColor(renderer, 80, 90, 110, 255); //wall fallback
-            SDL_RenderFillRect(renderer, &rect);
         }
     }
 }
 
-// return true if collision, false if no collision
-bool Game::DetectCollision(const Entity& entity, float nextX, float nextY) {
-    // Use a smaller inset for tiny entities (like 5x5 bullets)
-    const float minHalfSize = std::min(entity.width, entity.height) * 0.5f;
-    const float collisionInset = std::min(6.0f, std::max(0.0f, minHalfSize - 0.5f));
-    float x = nextX + collisionInset;
-    float y = nextY + collisionInset;
-    float width = entity.width - collisionInset * 2.0f;
-    float height = entity.height - collisionInset * 2.0f;
-
-    if (width < 1.0f) width = 1.0f;
-    if (height < 1.0f) height = 1.0f;
-
-    int leftTile   = (int)(x / tileSize);
-    int rightTile  = (int)((x + width - 1) / tileSize);
-    int topTile    = (int)(y / tileSize);
-    int bottomTile = (int)((y + height - 1) / tileSize);
-
-    // Check each corner
-    for (int tileY = topTile; tileY <= bottomTile; tileY++) {
-        for (int tileX = leftTile; tileX <= rightTile; tileX++) {
-            if (tileX < 0 || tileX >= mapWidth ||
-                tileY < 0 || tileY >= mapHeight)
-                return true;
-            int tile = map[tileY * mapWidth + tileX];
-            if (tile == 1 || tile == 2)
-                return true;
-
-            if (tile == 3 && tileHP[tileY * mapWidth + tileX] > 0) {
-                return true;
-            }
+void Game::ApplyTileEdits() {
+    // walls broken by the ticks behind this snapshot get patched into the baked map
+    for (const FrameSnapshot::TileEdit& edit : frame->tileEdits) {
+        if (edit.serial <= appliedTileSerial) {
+            continue;
         }
+        renderMap.SetTile(edit.x, edit.y, edit.type, edit.hp);
+        mapLayer.MarkTileDirty(edit.x, edit.y);
+        appliedTileSerial = edit.serial;
     }
-    return false;
+    simRunner.AcknowledgeTileEdits(appliedTileSerial);
 }
 
 bool Game::Init() {
     const int kLogicalWidth = 800;
     const int kLogicalHeight = 600;
     SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "0");
+    printf("Seed: %llu\n", (unsigned long long)world.GetSeed());
+    jobs.Start(threadCount);
+    world.SetJobSystem(&jobs);
+    SyncRenderMap();
+    simRunner.Refresh();
+    frame = &simRunner.AcquireSnapshot();
+    if (simThreadEnabled) {
+        simRunner.StartThread();
+    }
 
     if (SDL_Init(SDL_INIT_VIDEO) != 0) {
         printf("SDL_Init Error: %s\n", SDL_GetError());
@@ -334,7 +271,11 @@ bool Game::Init() {
         return false;
     }
 
-    renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
+    Uint32 rendererFlags = SDL_RENDERER_ACCELERATED;
+    if (vsyncEnabled) {
+        rendererFlags |= SDL_RENDERER_PRESENTVSYNC;
+    }
+    renderer = SDL_CreateRenderer(window, -1, rendererFlags);
     if (!renderer) {
         printf("SDL_CreateRenderer Error: %s\n", SDL_GetError());
         SDL_DestroyWindow(window);
@@ -354,40 +295,34 @@ bool Game::Init() {
         return false;
     }
 
-    playerTexture = LoadTextureWithFallback(renderer, "sprites/sprite.png");
-    if (!playerTexture) {
-        printf("IMG_LoadTexture Error: %s\n", IMG_GetError());
+    // The pack built next to the executable is one open for every asset; the
+    // asset root is only searched for once something has to come from a loose file
+    if (useAssetPack) {
+        assets.OpenPack("assets.pack");
+    }
+    assets.ResolveRootOnMiss(SpriteAtlas::GetPath(SPRITE_PLAYER));
+    spriteAtlas.Load(renderer, assets);
+    if (!spriteAtlas.Has(SPRITE_PLAYER)) {
+        printf("IMG_Load Error: %s\n", IMG_GetError());
+        spriteAtlas.Release();
         IMG_Quit();
         SDL_DestroyRenderer(renderer);
         SDL_DestroyWindow(window);
         SDL_Quit();
         return false;
     }
-
-    playerWalkTexture1 = LoadTextureWithFallback(renderer, "sprites/walking-1.png");
-    playerWalkTexture2 = LoadTextureWithFallback(renderer, "sprites/walking-3.png");
-    playerPistolTexture = LoadTextureWithFallback(renderer, "sprites/sprite_with_pistol.png");
-    playerShotgunTexture = LoadTextureWithFallback(renderer, "sprites/sprite_with_shotgun.png");
-    playerSmgTexture = LoadTextureWithFallback(renderer, "sprites/sprite_with_smg.png");
-    playerPistolWalkTexture1 = LoadTextureWithFallback(renderer, "sprites/pistol-walking-1.png");
-    playerPistolWalkTexture2 = LoadTextureWithFallback(renderer, "sprites/pistol-walking-3.png");
-    playerShotgunWalkTexture1 = LoadTextureWithFallback(renderer, "sprites/shotgun-walking-1.png");
-    playerShotgunWalkTexture2 = LoadTextureWithFallback(renderer, "sprites/shotgun-walking-3.png");
-    playerSmgWalkTexture1 = LoadTextureWithFallback(renderer, "sprites/smg-walking-1.png");
-    playerSmgWalkTexture2 = LoadTextureWithFallback(renderer, "sprites/smg-walking-3.png");
-    inventoryPistolTexture = LoadTextureWithFallback(renderer, "sprites/pistol.png");
-    inventoryShotgunTexture = LoadTextureWithFallback(renderer, "sprites/shotgun.png");
-    inventorySmgTexture = LoadTextureWithFallback(renderer, "sprites/smg.png");
-    wallTexture = LoadTextureWithFallback(renderer, "sprites/brickwall4.png");
-    floorTexture = LoadTextureWithFallback(renderer, "sprites/floor5.png");
-    brokenWallTexture = LoadTextureWithFallback(renderer, "sprites/brokenWall.png");
-    healthTexture = LoadTextureWithFallback(renderer, "sprites/heart.png");
-    speedTexture = LoadTextureWithFallback(renderer, "sprites/speedbooster.png");
-    weaponItemsTexture = LoadTextureWithFallback(renderer, "sprites/chest.png");
+    mapLayer.SetAtlas(spriteAtlas);
 
     previousState = currentState;
     running = true;
     menu = new Menu(renderer);
+    menu->LoadFont(assets);
+    hudText.Load(renderer, assets, "BitcountGridDouble.ttf", 18);
+    smallText.Load(renderer, assets, "BitcountGridDouble.ttf", 14);
+    largeText.Load(renderer, assets, "BitcountGridDouble.ttf", 24);
+    if (showAssetTimings) {
+        assets.PrintLoadTimings();
+    }
     return true;
 }
 
@@ -396,6 +331,7 @@ bool Game::IsRunning() {
 }
 
 void Game::HandleEvents() {
+    PROFILE_SCOPE("HandleEvents");
     SDL_Event event;
     while (SDL_PollEvent(&event)) {
         if (event.type == SDL_QUIT) {
@@ -410,11 +346,22 @@ void Game::HandleEvents() {
                 currentState = previousState;
             }
         }
+        else if (event.type == SDL_KEYDOWN && event.key.keysym.scancode == SDL_SCANCODE_F3 && !event.key.repeat) {
+            showProfiler = !showProfiler;
+        }
+        else if (event.type == SDL_RENDER_TARGETS_RESET || event.type == SDL_RENDER_DEVICE_RESET) {
+            // baked map chunks are lost with the render targets
+            mapLayer.Invalidate();
+        }
     }
 }
 
 void Game::Update() {
+    PROFILE_SCOPE("Update");
     float deltaTime = getDeltaTime();
+    if (currentState != PLAYING) {
+        simRunner.Pause();
+    }
     switch(currentState) {
         case (Game::MENU):
             UpdateMenu();
@@ -478,15 +425,169 @@ void Game::UpdateOptionsMenu() {
 }
 
 void Game::UpdatePlayingGameState(float deltaTime) {
-    float dx = 0.0f;
-    float dy = 0.0f;
-    HandlePlayerInput(deltaTime, dx, dy);
+    if ((recording || replaying) && !loggedRunStarted) {
+        BeginLoggedRun();
+    }
+    InputFrame input = replaying ? InputFrame() : PollInput();
     HandlePauseInput();
     if (currentState != PLAYING) {
+        simRunner.Pause();
+        return;
+    }
+    if (!simRunner.IsActive() && !simRunner.HasEnded()) {
+        // back from a menu or a level change: tick on from the world as it is now
+        SyncRenderMap();
+        simRunner.Resume();
+        seenShotCount = simRunner.AcquireSnapshot().shotCount;
+    }
+    if (!replaying) {
+        simRunner.SetLiveInput(input);
+    }
+    simRunner.Advance(deltaTime); // does nothing when the runner has its own thread
+    // read before acquiring, so an ended run's final snapshot is the one we get
+    bool ended = simRunner.HasEnded();
+    frame = &simRunner.AcquireSnapshot();
+    ApplyTileEdits();
+
+    if (frame->shotCount != seenShotCount) {
+        // a tick fired since the last frame: start the recoil animation
+        seenShotCount = frame->shotCount;
+        lastShotDirX = frame->lastShotDirX;
+        lastShotDirY = frame->lastShotDirY;
+        shootAnimTimer = shootAnimDuration;
+    }
+    if (replaying) {
+        const InputFrame& played = frame->lastInput;
+        playerIsMoving = (played.moveX != 0.0f || played.moveY != 0.0f);
+        if (played.moveX != 0.0f) {
+            playerFacingLeft = played.moveX < 0.0f;
+        }
+    }
+    renderAlpha = frame->GetRenderAlpha(std::chrono::steady_clock::now());
+
+    UpdatePlayerAnimation(deltaTime);
+    UpdateCamera();
+    UpdateClamp();
+    if (ended) {
+        simRunner.Pause();
+        if (frame->inputEnded) {
+            FinishReplay(replayEndReason);
+        } else {
+            ApplyWorldStatus(frame->status);
+        }
+    }
+}
+
+Entity Game::GetRenderPlayer() const {
+    const Entity& previous = frame->previousPlayer;
+    const Entity& current = frame->player;
+    Entity interpolated = current;
+    interpolated.x = previous.x + (current.x - previous.x) * renderAlpha;
+    interpolated.y = previous.y + (current.y - previous.y) * renderAlpha;
+    return interpolated;
+}
+
+void Game::ApplyWorldStatus(World::Status status) {
+    if (status == World::GAME_OVER) {
+        highScoreResetInGameOver = false;
+        if (!replaying) {
+            SaveHighScore();
+        }
+        currentState = GAME_OVER;
+        TRACE_INSTANT("GameOver", "level", world.GetLevel());
+    } else if (status == World::LEVEL_COMPLETE) {
+        currentState = LEVEL_COMPLETE;
+        TRACE_INSTANT("LevelComplete", "level", world.GetLevel());
+    }
+}
+
+// Recording and replay both start from a world rebuilt from the log header,
+// so a replay doesn't depend on what the menus did before play began.
+void Game::BeginLoggedRun() {
+    loggedRunStarted = true;
+    if (recording) {
+        InputLog::Header header;
+        header.seed = world.GetSeed();
+        header.mapWidth = world.GetMapWidth();
+        header.mapHeight = world.GetMapHeight();
+        header.spawnX = screenWidth / 2;
+        header.spawnY = screenHeight / 2;
+        header.stepSize = simRunner.GetStepSize();
+        header.difficultyMultiplier = GetDifficultyMultiplier();
+        inputLog.Begin(header);
+        simRunner.SetRecordLog(&inputLog);
+    } else {
+        // the logged step size, not one rebuilt from a tick rate, so replays match bit for bit
+        simRunner.SetStepSize(inputLog.GetHeader().stepSize);
+        simRunner.SetInputSource([this](InputFrame& input) { return NextReplayTick(input); });
+        replayCursor = 0;
+    }
+    inputLog.PrepareWorld(world);
+    shootAnimTimer = 0.0f;
+}
+
+// Runs on the sim thread. The main thread leaves the log and cursor alone
+// until the runner parks, then calls FinishReplay with the reason.
+bool Game::NextReplayTick(InputFrame& input) {
+    if (replayCursor >= inputLog.GetEntryCount()) {
+        replayEndReason = "finished";
+        return false;
+    }
+    const InputLog::Entry& entry = inputLog.GetEntry(replayCursor);
+    if (entry.kind != InputLog::TICK) {
+        replayEndReason = "desynced: level change logged while the level was still running";
+        return false;
+    }
+    replayCursor++;
+    input = entry.input;
+    return true;
+}
+
+void Game::ApplyReplayLevelChange(InputLog::EntryKind kind) {
+    if (replayCursor >= inputLog.GetEntryCount()) {
+        FinishReplay("finished");
+        return;
+    }
+    const InputLog::Entry& entry = inputLog.GetEntry(replayCursor);
+    if (entry.kind != kind) {
+        FinishReplay("desynced: expected a different level change");
         return;
     }
-    HandleReloadInput();
-    UpdateGame(deltaTime, dx, dy);
+    replayCursor++;
+    if (kind == InputLog::NEXT_LEVEL) {
+        world.StartNextLevel(entry.difficultyMultiplier);
+    } else {
+        world.Restart(entry.difficultyMultiplier);
+        shootAnimTimer = 0.0f;
+    }
+    currentState = PLAYING;
+}
+
+void Game::FinishReplay(const char* reason) {
+    printf("Replay %s after %d of %d ticks: level %d, score %d, state hash %016llx\n",
+           reason, replayCursor, inputLog.GetEntryCount(), world.GetLevel(), world.GetScore(),
+           (unsigned long long)world.ComputeStateHash());
+    replaying = false;
+    running = false;
+}
+
+InputFrame Game::PollInput() {
+    InputFrame input;
+    HandlePlayerMovementInput(input);
+    HandleReloadInput(input);
+    HandleInventoryInput(input);
+
+    const Uint8* keystate = SDL_GetKeyboardState(NULL);
+    input.meleePressed = keystate[SDL_SCANCODE_SPACE];
+
+    int mouseX = 0;
+    int mouseY = 0;
+    Uint32 mouseState = SDL_GetMouseState(nullptr, nullptr);
+    input.firePressed = (mouseState & SDL_BUTTON(SDL_BUTTON_LEFT)) != 0;
+    GetLogicalMousePosition(renderer, mouseX, mouseY);
+    input.aimX = mouseX + cameraX;
+    input.aimY = mouseY + cameraY;
+    return input;
 }
 
 void Game::HandlePauseInput() {
@@ -507,15 +608,11 @@ void Game::HandlePauseInput() {
     }
 }
 
-void Game::HandlePlayerInput(float deltaTime, float& dx, float& dy) {
-   HandlePlayerMovementInput(deltaTime, dx, dy);
-}
-
-void Game::HandlePlayerMovementInput(float deltaTime, float& dx, float& dy) {
-     const Uint8* keystate = SDL_GetKeyboardState(NULL);
+void Game::HandlePlayerMovementInput(InputFrame& input) {
+    const Uint8* keystate = SDL_GetKeyboardState(NULL);
     //direction vector
-    dx = 0.0f;
-    dy = 0.0f;
+    float dx = 0.0f;
+    float dy = 0.0f;
     if (keystate[SDL_SCANCODE_W])
         dy -= 1;
     if (keystate[SDL_SCANCODE_S])
@@ -532,9 +629,11 @@ void Game::HandlePlayerMovementInput(float deltaTime, float& dx, float& dy) {
     }
 
     playerIsMoving = (dx != 0.0f || dy != 0.0f);
+    input.moveX = dx;
+    input.moveY = dy;
 }
 
-void Game::HandleInventoryInput() {
+void Game::HandleInventoryInput(InputFrame& input) {
     const Uint8* keystate = SDL_GetKeyboardState(NULL);
     static bool ePressedLastFrame = false;
     // Toggle inventory
@@ -548,24 +647,21 @@ void Game::HandleInventoryInput() {
     }
 
     if (inventoryOpen) {
-        for (int i = 0; i < playerWeapons.size(); i++) {
-        if (keystate[SDL_SCANCODE_1 + i]) {
-            if (currentLevel >= playerWeapons[i].GetRequiredLevel()) {
-                currentWeaponIndex = i;
-                }
+        int weaponCount = (int)frame->playerWeapons.size();
+        for (int i = 0; i < weaponCount; i++) {
+            if (keystate[SDL_SCANCODE_1 + i]) {
+                input.selectWeaponSlot = i;
             }
         }
     }
 }
 
-void Game::HandleReloadInput() {
+void Game::HandleReloadInput(InputFrame& input) {
     const Uint8* keystate = SDL_GetKeyboardState(NULL);
     static bool rPressedLastFrame = false;
     if (keystate[SDL_SCANCODE_R]) {
         if (!rPressedLastFrame) {
-            if (!playerWeapons.empty()) {
-                playerWeapons[currentWeaponIndex].StartReload();
-            }
+            input.reloadPressed = true;
         }
         rPressedLastFrame = true;
     } else {
@@ -573,29 +669,10 @@ void Game::HandleReloadInput() {
     }
 }
 
-void Game::UpdatePlayer(float deltaTime) {
-    // If player is currently in death animation, update timer and check if we should switch to game over screen
-    if (playerDying) {
-        playerDeathTimer -= deltaTime;
-        if (playerDeathTimer <= 0.0f) {
-            playerDeathTimer = 0.0f;
-            currentState = GAME_OVER;
-        }
-        return;
-    }
-
-    if (playerInvulnTimer > 0.0f)
-        playerInvulnTimer -= deltaTime;
-
-    if (playerHP <= 0) {
-        highScoreResetInGameOver = false;
-        SaveHighScore();
-        playerDying = true;
-        playerDeathTimer = playerDeathDuration;
+void Game::UpdatePlayerAnimation(float deltaTime) {
+    if (frame->playerDying) {
         return;
     }
-    if (shootCooldown > 0.0f)
-        shootCooldown -= deltaTime;
     if (shootAnimTimer > 0.0f) {
         shootAnimTimer -= deltaTime;
         if (shootAnimTimer < 0.0f) {
@@ -615,348 +692,46 @@ void Game::UpdatePlayer(float deltaTime) {
     }
 }
 
-void Game::UpdateEnemy(float deltaTime) {
-    int enemiesBefore = (int)enemies.size();
-    const Uint8* keystate = SDL_GetKeyboardState(NULL);
-    bool levelComplete = false;
-    CombatSystem::UpdateEnemy(
-        deltaTime,
-        enemies,
-        player,
-        playerMeleeDamage,
-        [this](const Entity& ent, float x, float y) {
-            return DetectCollision(ent, x, y);
-        },
-        keystate[SDL_SCANCODE_SPACE],
-        levelComplete
-    );
-
-    int enemiesAfter = (int)enemies.size();// check for meele attacks by player
-    int kills = enemiesBefore - enemiesAfter;
-    AddKillScore(kills);
-
-    if (levelComplete) {
-        currentState = LEVEL_COMPLETE;
-    }
-}
-
-void Game::UpdateCamera(float deltaTime, float dx, float dy) {
+void Game::UpdateCamera() {
+    Entity player = GetRenderPlayer();
     cameraX = player.x - screenWidth / 2;
     cameraY = player.y - screenHeight / 2;
 
-    int maxCameraX = mapWidth * tileSize - screenWidth;
-    int maxCameraY = mapHeight * tileSize - screenHeight;
+    int maxCameraX = frame->mapWidth * tileSize - screenWidth;
+    int maxCameraY = frame->mapHeight * tileSize - screenHeight;
     if(cameraX > maxCameraX) cameraX = maxCameraX;
     if(cameraX < 0) cameraX = 0;
     if(cameraY > maxCameraY) cameraY = maxCameraY;
     if(cameraY < 0) cameraY = 0;
 }
 
-void Game::UpdateCollision(float deltaTime, float dx, float dy) {
-    CombatSystem::UpdatePlayerCollision(
-        deltaTime,
-        dx,
-        dy,
-        player,
-        enemies,
-        playerInvulnTimer,
-        playerSpeed,
-        playerHP,
-        [this](const Entity& ent, float x, float y) {
-            return DetectCollision(ent, x, y);
-        }
-    );
-}
-
 void Game::UpdateClamp() {
     // top left corner is the coords for the camera
     // Clamp keeps the view inside the world.
-    cameraX = Clamp(cameraX, 0, mapWidth * tileSize - screenWidth);
-    cameraY = Clamp(cameraY, 0, mapHeight * tileSize - screenHeight);
-}
-
-void Game::UpdateGame(float deltaTime, float dx, float dy) {
-        UpdatePlayer(deltaTime);
-        if (playerDying) {
-           return;
-        }
-        UpdateTimer(deltaTime);
-        UpdateBreakingWallTime(deltaTime);
-        UpdateCollision(deltaTime, dx, dy);
-        UpdateHealthItems();
-        UpdateSpeedItems(deltaTime);
-        UpdateWeaponItems();
-        UpdateEnemy(deltaTime);
-        UpdateCamera(deltaTime, dx, dy);
-        UpdateClamp();
-        DetectMouseClick();
-        UpdateWeaponCooldown(deltaTime);
-        UpdateReloadCooldown(deltaTime);
-        UpdateBullets(deltaTime);
-        HandleInventoryInput();
-
-}
-
-void Game::UpdateTimer(float deltaTime) {
-    levelTimer -= deltaTime;
-    if (levelTimer <= 0.0f) {
-        levelTimer = 0.0f;
-        currentState = GAME_OVER;
-    }
-}
-
-void Game::UpdateBreakingWallTime(float deltaTime) {
-    for (auto& eff : wallBreakEffects) {
-        eff.timer = std::max(0.0f, eff.timer - deltaTime);
-    }
-    wallBreakEffects.erase(
-        std::remove_if(wallBreakEffects.begin(), wallBreakEffects.end(),
-            [](const WallBreakEffect& e){ return e.timer <= 0.0f; }),
-        wallBreakEffects.end()
-    );
-}
-
-void Game::UpdateWeaponCooldown(float deltaTime) {
-    if (!playerWeapons.empty())
-        playerWeapons[currentWeaponIndex].UpdateCooldown(deltaTime);
-}
-
-void Game::UpdateReloadCooldown(float deltaTime) {
-    if (!playerWeapons.empty())
-        playerWeapons[currentWeaponIndex].UpdateReloadCooldown(deltaTime);
+    cameraX = Clamp(cameraX, 0, frame->mapWidth * tileSize - screenWidth);
+    cameraY = Clamp(cameraY, 0, frame->mapHeight * tileSize - screenHeight);
 }
 
-void Game::UpdateBullets(float deltaTime) {
-    int enemiesBefore = (int)enemies.size();
-    CombatSystem::UpdateBullets(
-        deltaTime,
-        bullets,
-        enemies,
-        [this](const Entity& ent, float x, float y) {
-            return DetectCollision(ent, x, y);
-        },
-        [this](float x, float y, int damage) {
-            DamageTileAtWorld(x, y, damage);
-        }
-    );
-
-    int enemiesAfter = (int)enemies.size();
-    int kills = enemiesBefore - enemiesAfter;
-    AddKillScore(kills);
-}
-
-void Game::AddKillScore(int kills) {
-    if (kills <= 0) {
+void Game::UpdateLevelComplete() {
+    if (replaying) {
+        ApplyReplayLevelChange(InputLog::NEXT_LEVEL);
         return;
     }
-
-    float timeLeft = std::max(0.0f, levelTimer);
-    bonusTime = (int)timeLeft;
-    score += (int)((timeLeft / 2.0f) * kills);
-}
-
-void Game::UpdateHealthItems() {
-    for (auto &h : healthItems) {
-        if (!h.collected) {
-            Entity itemEntity{h.x, h.y, h.width, h.height};
-            if (CombatSystem::AABB(player, itemEntity)) {
-                playerHP += (int)(playerMaxHP * 0.2f); // heal 20%
-                if (playerHP > playerMaxHP)
-                    playerHP = playerMaxHP;
-                h.collected = true;
-            }
-        }
-    }
-
-    healthItems.erase(
-        std::remove_if(healthItems.begin(), healthItems.end(),
-            [](const HealthItem &h){ return h.collected; }),
-        healthItems.end()
-    );
-}
-
-void Game::UpdateSpeedItems(float deltaTime) {
-    if (speedItemActive) {
-        speedItemTimer -= deltaTime;
-        if (speedItemTimer <= 0.0f) {
-            speedItemTimer = 0.0f;
-            playerSpeed = playerBaseSpeed;
-            speedItemActive = false;
-        }
-    }
-
-    for (auto &s : speedItems) {
-        if (!s.collected) {
-            Entity itemEntity{s.x, s.y, s.width, s.height};
-            if (CombatSystem::AABB(player, itemEntity)) {
-                if (!speedItemActive) {
-                    playerSpeed = playerBaseSpeed + speedItemAmount;
-                    speedItemTimer = speedItemDuration;
-                    speedItemActive = true;
-                    s.collected = true;
-                }
-            }
-        }
-    }
-
-    speedItems.erase(
-        std::remove_if(speedItems.begin(), speedItems.end(),
-            [](const SpeedItem &s){ return s.collected; }),
-        speedItems.end()
-    );
-}
-
-void Game::UpdateWeaponItems() {
-    //only add weapon to inventory if not already owned
-    if (currentLevel == 2) {
-        // only spawn rifle in level 2
-        for (auto &w : weaponItems) {
-            if (w.type != Weapon::RIFLE) {
-                w.collected = true;
-            }
-        }
-    }
-
-    if (currentLevel == 3) {
-        // only spawn shotgun in level 3
-        for (auto &w : weaponItems) {
-            if (w.type != Weapon::SHOTGUN) {
-                w.collected = true;
-            }
-        }
-    }
-
-    if (currentLevel == 4) {
-        // only spawn machinegun in level 4
-        for (auto &w : weaponItems) {
-            if (w.type != Weapon::MACHINEGUN) {
-                w.collected = true;
-            }
-        }
-    }
-
-    for (auto &w : weaponItems) {
-        if (!w.collected) {
-            Entity itemEntity{w.x, w.y, w.width, w.height};
-            if (CombatSystem::AABB(player, itemEntity)) {
-                // Add weapon to inventory if not already owned
-                bool alreadyOwned = false;
-                for (auto &wp : playerWeapons) {
-                    if (wp.GetType() == w.type) {
-                        alreadyOwned = true;
-                        break;
-                    }
-                }
-                if (!alreadyOwned)
-                    playerWeapons.push_back(Weapon(w.type));
-
-                w.collected = true;
-            }
-        }
-    }
-
-    // remove collected items
-    weaponItems.erase(
-        std::remove_if(weaponItems.begin(), weaponItems.end(),
-            [](const WeaponItem &w){ return w.collected; }),
-        weaponItems.end()
-    );
-}
-
-void Game::DetectMouseClick() {
-    int mouseX = 0;
-    int mouseY = 0;
-    Uint32 mouseState = SDL_GetMouseState(nullptr, nullptr);
-    bool firePressed = (mouseState & SDL_BUTTON(SDL_BUTTON_LEFT)) != 0;
-    GetLogicalMousePosition(renderer, mouseX, mouseY);
-    float worldMouseX = mouseX + cameraX;
-    float worldMouseY = mouseY + cameraY;
-
-    size_t bulletsBefore = bullets.size();
-    CombatSystem::DetectMouseClick(
-        player,
-        playerWeapons,
-        currentWeaponIndex,
-        bullets,
-        worldMouseX,
-        worldMouseY,
-        firePressed
-    );
-    // If a shot was fired, start recoil animation
-    if (bullets.size() > bulletsBefore) {
-        float aimDx = worldMouseX - (player.x + player.width * 0.5f);
-        float aimDy = worldMouseY - (player.y + player.height * 0.5f);
-        float aimLen = std::sqrt(aimDx * aimDx + aimDy * aimDy);
-        if (aimLen > 0.0f) {
-            lastShotDirX = aimDx / aimLen;
-            lastShotDirY = aimDy / aimLen;
-        }
-        shootAnimTimer = shootAnimDuration;
-    }
-}
-
-void Game::UpdateLevelComplete() {
     const Uint8* keystate = SDL_GetKeyboardState(NULL);
     if (keystate[SDL_SCANCODE_RETURN]) {
-        currentLevel++;
-        levelTimer = 100.0f;
-        bonusTime = 0;
-        enemies.clear();
-        bullets.clear();
-        speedItems.clear();
-        weaponItems.clear();
-        SpawnSystem::SpawnEnemies(
-            5 + currentLevel,
-            enemies,
-            player,
-            currentLevel,
-            mapWidth,
-            mapHeight,
-            tileSize,
-            [this](const Entity& ent, float x, float y) {
-                return DetectCollision(ent, x, y);
-            },
-            GetDifficultyMultiplier()
-        );
-        SpawnSystem::SpawnHealthItems(
-            2,
-            healthItems,
-            player,
-            mapWidth,
-            mapHeight,
-            tileSize,
-            [this](const Entity& ent, float x, float y) {
-                return DetectCollision(ent, x, y);
-            }
-        );
-        SpawnSystem::SpawnSpeedItems(
-            1,
-            speedItems,
-            player,
-            mapWidth,
-            mapHeight,
-            tileSize,
-            [this](const Entity& ent, float x, float y) {
-                return DetectCollision(ent, x, y);
-            }
-        );
-        SpawnSystem::SpawnWeaponItems(
-            1,
-            weaponItems,
-            player,
-            currentLevel,
-            mapWidth,
-            mapHeight,
-            tileSize,
-            [this](const Entity& ent, float x, float y) {
-                return DetectCollision(ent, x, y);
-            }
-        );
+        world.StartNextLevel(GetDifficultyMultiplier());
+        if (recording) {
+            inputLog.AddNextLevel(GetDifficultyMultiplier());
+        }
         currentState = PLAYING;
     }
 }
 
 void Game::UpdateGameOver() {
+    if (replaying) {
+        ApplyReplayLevelChange(InputLog::RESTART);
+        return;
+    }
     // Handle game over logic (e.g., show message, wait for input)
     const Uint8* keystate = SDL_GetKeyboardState(NULL);
     static bool gPressedLastFrame = false;
@@ -979,113 +754,16 @@ void Game::UpdateGameOver() {
         }
         
         // Reset game state
-        currentLevel = 1;
-        levelTimer = 100.0f;
-        bonusTime = 0;
-        player.x = screenWidth / 2;
-        player.y = screenHeight / 2;
-        enemies.clear();
-        bullets.clear();
-        healthItems.clear();
-        speedItems.clear();
-        weaponItems.clear();
-        playerWeapons.clear();
-        playerWeapons.push_back(Weapon(Weapon::PISTOL));
-        currentWeaponIndex = 0;
-        playerSpeed = playerBaseSpeed;
-        speedItemActive = false;
-        speedItemTimer = 0.0f;
-
-        SpawnSystem::SpawnEnemies(
-            5,
-            enemies,
-            player,
-            currentLevel,
-            mapWidth,
-            mapHeight,
-            tileSize,
-            [this](const Entity& ent, float x, float y) {
-                return DetectCollision(ent, x, y);
-            },
-            GetDifficultyMultiplier()
-        );
-        SpawnSystem::SpawnHealthItems(
-            2,
-            healthItems,
-            player,
-            mapWidth,
-            mapHeight,
-            tileSize,
-            [this](const Entity& ent, float x, float y) {
-                return DetectCollision(ent, x, y);
-            }
-        );
-        SpawnSystem::SpawnSpeedItems(
-            1,
-            speedItems,
-            player,
-            mapWidth,
-            mapHeight,
-            tileSize,
-            [this](const Entity& ent, float x, float y) {
-                return DetectCollision(ent, x, y);
-            }
-        );
-        SpawnSystem::SpawnWeaponItems(
-            1,
-            weaponItems,
-            player,
-            currentLevel,
-            mapWidth,
-            mapHeight,
-            tileSize,
-            [this](const Entity& ent, float x, float y) {
-                return DetectCollision(ent, x, y);
-            }
-        );
+        world.Restart(GetDifficultyMultiplier());
+        if (recording) {
+            inputLog.AddRestart(GetDifficultyMultiplier());
+        }
         currentState = PLAYING;
-        playerHP = 30;
-        playerMaxHP = 30;
-        playerInvulnTimer = 0.0f;
-        score = 0;
         highScoreResetInGameOver = false;
-        playerDying = false;
-        playerDeathTimer = 0.0f;
         shootAnimTimer = 0.0f;
     }
 }
 
-void Game::DamageTileAtWorld(float worldX, float worldY, int damage) {
-    int tileX = (int)(worldX / tileSize);
-    int tileY = (int)(worldY / tileSize);
-    if (tileX < 0 || tileX >= mapWidth || tileY < 0 || tileY >= mapHeight)
-        return;
-    
-    int index = tileY * mapWidth + tileX;
-    if (map[index] != 3) return;
-
-    // Push a new effect (or reset existing one at same tile)
-    float wx = tileX * tileSize + tileSize / 2.0f;
-    float wy = tileY * tileSize + tileSize / 2.0f;
-    bool found = false;
-    for (auto& eff : wallBreakEffects) {
-        if ((int)eff.worldX == (int)wx && (int)eff.worldY == (int)wy) {
-            eff.timer = breakingWallDuration;
-            found = true;
-            break;
-        }
-    }
-    if (!found) {
-        wallBreakEffects.push_back({wx, wy, breakingWallDuration});
-    }
-
-    tileHP[index] -= damage;
-    if (tileHP[index] <= 0) {
-        tileHP[index] = 0;
-        map[index] = 0; // turn into floor
-    }
-}
-
 double Game::Clamp(double a, double minimum, double maximum) {
     if (a < minimum) return minimum;
     if (a > maximum) return maximum;
@@ -1153,28 +831,62 @@ void Game::RenderLevelComplete() {
 void Game::RenderGame() {
     RenderGameScene();
 
+    PROFILE_SCOPE("Render.Present");
     //update screen, swaps the back buffer to the screen
     //present
     SDL_RenderPresent(renderer);
 }
 
 void Game::DrawBreakingWall() {
-    for (const auto& eff : wallBreakEffects) {
-        float life01 = eff.timer / breakingWallDuration;
+    for (const auto& eff : frame->wallBreakEffects) {
+        float life01 = eff.timer / frame->breakingWallDuration;
         RenderBreakingWallEffect(eff.worldX, eff.worldY, life01);
     }
 }
 
 void Game::RenderGameScene() {
+    PROFILE_SCOPE("Render.Scene");
     //clear screen to black
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
     SDL_RenderClear(renderer);
+    spriteBatch.ResetStats();
 
     //draw map
     DrawMap();
-    DrawBreakingWall();
 
-    //draw player
+    // Everything in the world goes through one batch; layers keep items under
+    // actors, effects over them and health bars on top.
+    {
+        PROFILE_SCOPE("Render.Sprites");
+        spriteBatch.Begin(renderer, spriteAtlas);
+        DrawBreakingWall();
+        DrawItems();
+        DrawPlayer();
+        EnemyRender::Draw(frame->enemies, cameraX, cameraY, spriteBatch, renderAlpha);
+        DrawBullets();
+        PlayerHP();
+        EnemyHP();
+        spriteBatch.Flush();
+    }
+
+    PROFILE_SCOPE("Render.HUD");
+    DisplayAmmo();
+    DisplayScore();
+    DisplayTimer();
+    if (showRenderStats) {
+        DisplayRenderStats();
+    }
+    if (showProfiler) {
+        DisplayProfiler();
+    }
+    DrawInventory();
+}
+
+void Game::DrawPlayer() {
+    Entity player = GetRenderPlayer();
+    const std::vector<Weapon>& playerWeapons = frame->playerWeapons;
+    int currentWeaponIndex = frame->currentWeaponIndex;
+    bool playerDying = frame->playerDying;
     SDL_Rect playerRect = { 
         (int)(player.x - cameraX), 
         (int)(player.y - cameraY), 
@@ -1189,69 +901,53 @@ void Game::RenderGameScene() {
         playerRect.x -= (int)(lastShotDirX * recoil);
         playerRect.y -= (int)(lastShotDirY * recoil);
     }
-    SDL_Texture* currentPlayerTexture = playerTexture;
-    SDL_Texture* currentWalkTexture1 = playerWalkTexture1;
-    SDL_Texture* currentWalkTexture2 = playerWalkTexture2;
+    SpriteId currentPlayerSprite = SPRITE_PLAYER;
+    SpriteId currentWalkSprite1 = SPRITE_PLAYER_WALK_1;
+    SpriteId currentWalkSprite2 = SPRITE_PLAYER_WALK_2;
     if (!playerWeapons.empty()) {
         Weapon::WeaponType equippedType = playerWeapons[currentWeaponIndex].GetType();
-        if (equippedType == Weapon::PISTOL && playerPistolTexture) {
-            currentPlayerTexture = playerPistolTexture;
-            if (playerPistolWalkTexture1 && playerPistolWalkTexture2) {
-                currentWalkTexture1 = playerPistolWalkTexture1;
-                currentWalkTexture2 = playerPistolWalkTexture2;
+        if (equippedType == Weapon::PISTOL && spriteAtlas.Has(SPRITE_PLAYER_PISTOL)) {
+            currentPlayerSprite = SPRITE_PLAYER_PISTOL;
+            if (spriteAtlas.Has(SPRITE_PISTOL_WALK_1) && spriteAtlas.Has(SPRITE_PISTOL_WALK_2)) {
+                currentWalkSprite1 = SPRITE_PISTOL_WALK_1;
+                currentWalkSprite2 = SPRITE_PISTOL_WALK_2;
             }
-        } else if (equippedType == Weapon::SHOTGUN && playerShotgunTexture) {
-            currentPlayerTexture = playerShotgunTexture;
-            if (playerShotgunWalkTexture1 && playerShotgunWalkTexture2) {
-                currentWalkTexture1 = playerShotgunWalkTexture1;
-                currentWalkTexture2 = playerShotgunWalkTexture2;
+        } else if (equippedType == Weapon::SHOTGUN && spriteAtlas.Has(SPRITE_PLAYER_SHOTGUN)) {
+            currentPlayerSprite = SPRITE_PLAYER_SHOTGUN;
+            if (spriteAtlas.Has(SPRITE_SHOTGUN_WALK_1) && spriteAtlas.Has(SPRITE_SHOTGUN_WALK_2)) {
+                currentWalkSprite1 = SPRITE_SHOTGUN_WALK_1;
+                currentWalkSprite2 = SPRITE_SHOTGUN_WALK_2;
             }
-        } else if ((equippedType == Weapon::RIFLE || equippedType == Weapon::MACHINEGUN) && playerSmgTexture) {
-            currentPlayerTexture = playerSmgTexture;
-            if (playerSmgWalkTexture1 && playerSmgWalkTexture2) {
-                currentWalkTexture1 = playerSmgWalkTexture1;
-                currentWalkTexture2 = playerSmgWalkTexture2;
+        } else if ((equippedType == Weapon::RIFLE || equippedType == Weapon::MACHINEGUN) && spriteAtlas.Has(SPRITE_PLAYER_SMG)) {
+            currentPlayerSprite = SPRITE_PLAYER_SMG;
+            if (spriteAtlas.Has(SPRITE_SMG_WALK_1) && spriteAtlas.Has(SPRITE_SMG_WALK_2)) {
+                currentWalkSprite1 = SPRITE_SMG_WALK_1;
+                currentWalkSprite2 = SPRITE_SMG_WALK_2;
             }
         }
     }
 
-    if (playerIsMoving && currentWalkTexture1 && currentWalkTexture2) {
-        currentPlayerTexture = (playerWalkFrameIndex == 0) ? currentWalkTexture1 : currentWalkTexture2;
+    if (playerIsMoving && spriteAtlas.Has(currentWalkSprite1) && spriteAtlas.Has(currentWalkSprite2)) {
+        currentPlayerSprite = (playerWalkFrameIndex == 0) ? currentWalkSprite1 : currentWalkSprite2;
     }
 
     // Flash red when invulnerable or playerIsDying
+    SDL_Color tint = {255, 255, 255, 255};
     if (playerDying) {
-        float progress = 1.0f - (playerDeathTimer / playerDeathDuration);
+        float progress = frame->playerDeathProgress;
         if (progress < 0.2f) {
-            SDL_SetTextureColorMod(currentPlayerTexture, 255, 80, 80);
-            SDL_SetTextureAlphaMod(currentPlayerTexture, 255);
+            tint = {255, 80, 80, 255};
         } else {
             float alphaScale = 1.0f - progress;
             if (alphaScale < 0.0f) alphaScale = 0.0f;
-            Uint8 alpha = (Uint8)(255.0f * alphaScale);
-            SDL_SetTextureColorMod(currentPlayerTexture, 255, 255, 255);
-            SDL_SetTextureAlphaMod(currentPlayerTexture, alpha);
+            tint.a = (Uint8)(255.0f * alphaScale);
         }
-    } else if (playerInvulnTimer > 0.0f) {
-        SDL_SetTextureColorMod(currentPlayerTexture, 255, 80, 80);
-        SDL_SetTextureAlphaMod(currentPlayerTexture, 255);
-    } else {
-        SDL_SetTextureColorMod(currentPlayerTexture, 255, 255, 255);
-        SDL_SetTextureAlphaMod(currentPlayerTexture, 255);
+    } else if (frame->playerInvulnTimer > 0.0f) {
+        tint = {255, 80, 80, 255};
     }
 
-    if (currentPlayerTexture) {
-        SDL_SetTextureBlendMode(currentPlayerTexture, SDL_BLENDMODE_BLEND);
-        SDL_RendererFlip flip = playerFacingLeft ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE;
-        SDL_RenderCopyEx(renderer, currentPlayerTexture, nullptr, &playerRect, 0.0, nullptr, flip);
-    } else {
-        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-        SDL_RenderFillRect(renderer, &playerRect);
-    }
-
-    // reset blend mode after drawing player to avoid affecting other elements
-    if (playerDying) {
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    if (!spriteBatch.AddSprite(currentPlayerSprite, playerRect, tint, SpriteBatch::LAYER_ACTORS, playerFacingLeft)) {
+        spriteBatch.AddRect(playerRect, SDL_Color{255, 255, 255, 255}, SpriteBatch::LAYER_ACTORS);
     }
 
     // Draw shooting flash
@@ -1263,35 +959,27 @@ void Game::RenderGameScene() {
         int flashX = (int)(playerCenterX + lastShotDirX * (playerRect.w * 0.6f) - flashSize / 2);
         int flashY = (int)(playerCenterY + lastShotDirY * (playerRect.h * 0.6f) - flashSize / 2);
         SDL_Rect flashRect = { flashX, flashY, flashSize, flashSize };
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-        SDL_SetRenderDrawColor(renderer, 255, 200, 80, 200);
-        SDL_RenderFillRect(renderer, &flashRect);
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+        spriteBatch.AddRect(flashRect, SDL_Color{255, 200, 80, 200}, SpriteBatch::LAYER_EFFECTS);
     }
-    PlayerHP();
-    DisplayAmmo();
-    DisplayScore();
-    DisplayTimer();
-    
-    //draw enemies
-    for (auto &e : enemies)
-        e.Render(cameraX, cameraY, renderer);
-    EnemyHP();
-
+}
 
-    SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255);
-    // draw bullets
-    for (auto &b : bullets) {
+void Game::DrawBullets() {
+    const BulletPool& bullets = frame->bullets;
+    for (int i = 0; i < bullets.Size(); i++) {
+        float bulletX = bullets.GetPrevX(i) + (bullets.GetX(i) - bullets.GetPrevX(i)) * renderAlpha;
+        float bulletY = bullets.GetPrevY(i) + (bullets.GetY(i) - bullets.GetPrevY(i)) * renderAlpha;
         SDL_Rect rect = {
-            (int)(b.x - cameraX),
-            (int)(b.y - cameraY),
+            (int)(bulletX - cameraX),
+            (int)(bulletY - cameraY),
             5, 5
         };
-        SDL_RenderFillRect(renderer, &rect);
+        spriteBatch.AddRect(rect, SDL_Color{255, 255, 0, 255}, SpriteBatch::LAYER_EFFECTS);
     }
+}
 
+void Game::DrawItems() {
     // draw health items
-    for (auto &h : healthItems) {
+    for (auto &h : frame->healthItems) {
         if (!h.collected) {
             SDL_Rect rect = {
                 (int)(h.x - cameraX),
@@ -1299,17 +987,14 @@ void Game::RenderGameScene() {
                 (int)h.width,
                 (int)h.height
             };
-            if (healthTexture) {
-                SDL_RenderCopy(renderer, healthTexture, nullptr, &rect);
-            } else {
-                SDL_SetRenderDrawColor(renderer, 255, 0, 255, 255);
-                SDL_RenderFillRect(renderer, &rect);
+            if (!spriteBatch.AddSprite(SPRITE_HEALTH_ITEM, rect, SDL_Color{255, 255, 255, 255}, SpriteBatch::LAYER_GROUND)) {
+                spriteBatch.AddRect(rect, SDL_Color{255, 0, 255, 255}, SpriteBatch::LAYER_GROUND);
             }
         }
     }
 
     // draw speed items
-    for (auto &s : speedItems) {
+    for (auto &s : frame->speedItems) {
         if (!s.collected) {
             SDL_Rect rect = {
                 (int)(s.x - cameraX),
@@ -1317,17 +1002,14 @@ void Game::RenderGameScene() {
                 (int)s.width,
                 (int)s.height
             };
-            if (speedTexture) {
-                SDL_RenderCopy(renderer, speedTexture, nullptr, &rect);
-            } else {
-                SDL_SetRenderDrawColor(renderer, 0, 255, 255, 255);
-                SDL_RenderFillRect(renderer, &rect);
+            if (!spriteBatch.AddSprite(SPRITE_SPEED_ITEM, rect, SDL_Color{255, 255, 255, 255}, SpriteBatch::LAYER_GROUND)) {
+                spriteBatch.AddRect(rect, SDL_Color{0, 255, 255, 255}, SpriteBatch::LAYER_GROUND);
             }
         }
     }
 
     // draw weapon items
-    for (auto &w : weaponItems) {
+    for (auto &w : frame->weaponItems) {
         if (!w.collected) {
             SDL_Rect rect = {
                 (int)(w.x - cameraX),
@@ -1335,44 +1017,41 @@ void Game::RenderGameScene() {
                 (int)w.width,
                 (int)w.height
             };
-            if (weaponItemsTexture) {
-                SDL_RenderCopy(renderer, weaponItemsTexture, nullptr, &rect);
-            } else {
-                SDL_SetRenderDrawColor(renderer, 0, 0, 255, 255); // blue for weapons
-                SDL_RenderFillRect(renderer, &rect);
+            if (!spriteBatch.AddSprite(SPRITE_WEAPON_ITEM, rect, SDL_Color{255, 255, 255, 255}, SpriteBatch::LAYER_GROUND)) {
+                spriteBatch.AddRect(rect, SDL_Color{0, 0, 255, 255}, SpriteBatch::LAYER_GROUND); // blue for weapons
             }
         }
     }
+}
 
-    // draw inventory if open
-    if (inventoryOpen) {
-        int startX = 50;
-        int startY = 50;
-        int size = 40;
-        for (size_t i = 0; i < playerWeapons.size(); i++) {
-            SDL_Rect rect = { startX + (int)i*(size+10), startY, size, size };
-            if (i == currentWeaponIndex)
-                SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255); // highlight current
-            else
-                SDL_SetRenderDrawColor(renderer, 150, 150, 150, 255);
-            SDL_RenderFillRect(renderer, &rect);
-
-            SDL_Texture* weaponIconTexture = nullptr;
-            Weapon::WeaponType slotType = playerWeapons[i].GetType();
-            if (slotType == Weapon::PISTOL) {
-                weaponIconTexture = inventoryPistolTexture;
-            } else if (slotType == Weapon::SHOTGUN) {
-                weaponIconTexture = inventoryShotgunTexture;
-            } else if (slotType == Weapon::RIFLE || slotType == Weapon::MACHINEGUN) {
-                weaponIconTexture = inventorySmgTexture;
-            }
-
-            if (weaponIconTexture) {
-                SDL_Rect iconRect = { rect.x + 2, rect.y + 2, rect.w - 4, rect.h - 4 };
-                SDL_RenderCopy(renderer, weaponIconTexture, nullptr, &iconRect);
-            }
+void Game::DrawInventory() {
+    if (!inventoryOpen) {
+        return;
+    }
+    const std::vector<Weapon>& playerWeapons = frame->playerWeapons;
+    int currentWeaponIndex = frame->currentWeaponIndex;
+    int startX = 50;
+    int startY = 50;
+    int size = 40;
+    spriteBatch.Begin(renderer, spriteAtlas);
+    for (size_t i = 0; i < playerWeapons.size(); i++) {
+        SDL_Rect rect = { startX + (int)i*(size+10), startY, size, size };
+        SDL_Color slotColor = {150, 150, 150, 255};
+        if (i == currentWeaponIndex)
+            slotColor = {255, 255, 0, 255}; // highlight current
+        spriteBatch.AddRect(rect, slotColor, SpriteBatch::LAYER_OVERLAY);
+
+        Weapon::WeaponType slotType = playerWeapons[i].GetType();
+        SDL_Rect iconRect = { rect.x + 2, rect.y + 2, rect.w - 4, rect.h - 4 };
+        if (slotType == Weapon::PISTOL) {
+            spriteBatch.AddSprite(SPRITE_ICON_PISTOL, iconRect, SDL_Color{255, 255, 255, 255}, SpriteBatch::LAYER_OVERLAY);
+        } else if (slotType == Weapon::SHOTGUN) {
+            spriteBatch.AddSprite(SPRITE_ICON_SHOTGUN, iconRect, SDL_Color{255, 255, 255, 255}, SpriteBatch::LAYER_OVERLAY);
+        } else if (slotType == Weapon::RIFLE || slotType == Weapon::MACHINEGUN) {
+            spriteBatch.AddSprite(SPRITE_ICON_SMG, iconRect, SDL_Color{255, 255, 255, 255}, SpriteBatch::LAYER_OVERLAY);
         }
     }
+    spriteBatch.Flush();
 }
 
 void Game::RenderPauseOverlay() {
@@ -1387,37 +1066,38 @@ void Game::RenderPauseOverlay() {
 }
 
 void Game::PlayerHP() {
-    float hpRatio = (float)playerHP / (float)playerMaxHP;
+    Entity player = GetRenderPlayer();
+    float hpRatio = (float)frame->playerHP / (float)frame->playerMaxHP;
     SDL_Rect hpBarBack = { (int)(player.x - cameraX), (int)(player.y - cameraY - 10), (int)player.width, 5 };
-    SDL_SetRenderDrawColor(renderer, 100, 100, 100, 255); // dark gray background
-    SDL_RenderFillRect(renderer, &hpBarBack);
+    spriteBatch.AddRect(hpBarBack, SDL_Color{100, 100, 100, 255}, SpriteBatch::LAYER_OVERLAY); // dark gray background
 
     SDL_Rect hpBarFront = { (int)(player.x - cameraX), (int)(player.y - cameraY - 10), (int)(player.width * hpRatio), 5 };
-    SDL_SetRenderDrawColor(renderer, 0, 255, 0, 255); 
-    SDL_RenderFillRect(renderer, &hpBarFront);
+    spriteBatch.AddRect(hpBarFront, SDL_Color{0, 255, 0, 255}, SpriteBatch::LAYER_OVERLAY);
 }
 
 void Game::EnemyHP() {
-    for (auto &e : enemies) {
-        if (e.IsDead()) {
+    const EnemyPool& enemies = frame->enemies;
+    for (int i = 0; i < enemies.Size(); i++) {
+        if (enemies.IsDead(i)) {
             continue;
         }
-        float hpRatio = (float)e.GetHP() / (float)e.GetMaxHP();
-        Entity enemyBody = e.getBody();
+        float hpRatio = (float)enemies.GetHP(i) / (float)enemies.GetMaxHP(i);
+        Entity enemyBody = enemies.GetBody(i);
+        enemyBody.x = enemies.GetInterpolatedX(i, renderAlpha);
+        enemyBody.y = enemies.GetInterpolatedY(i, renderAlpha);
         SDL_Rect hpBarBack = { (int)(enemyBody.x - cameraX), (int)(enemyBody.y - cameraY - 10), (int)enemyBody.width, 5 };
-        SDL_SetRenderDrawColor(renderer, 100, 100, 100, 255); 
-        SDL_RenderFillRect(renderer, &hpBarBack);
+        spriteBatch.AddRect(hpBarBack, SDL_Color{100, 100, 100, 255}, SpriteBatch::LAYER_OVERLAY);
 
         SDL_Rect hpBarFront = { (int)(enemyBody.x - cameraX), (int)(enemyBody.y - cameraY - 10), (int)(enemyBody.width * hpRatio), 5 };
-        SDL_SetRenderDrawColor(renderer, 0, 255, 0, 255); 
-        SDL_RenderFillRect(renderer, &hpBarFront);
+        spriteBatch.AddRect(hpBarFront, SDL_Color{0, 255, 0, 255}, SpriteBatch::LAYER_OVERLAY);
     }
 }
 
 void Game::DisplayAmmo() {
+    const std::vector<Weapon>& playerWeapons = frame->playerWeapons;
     if (playerWeapons.empty()) return;
     
-    Weapon& currentWeapon = playerWeapons[currentWeaponIndex];
+    const Weapon& currentWeapon = playerWeapons[frame->currentWeaponIndex];
     int currentAmmo = currentWeapon.GetCurrentAmmo();
     int magSize = currentWeapon.GetMagSize();
     bool reloading = currentWeapon.IsReloading();
@@ -1453,122 +1133,145 @@ void Game::DisplayAmmo() {
     SDL_SetRenderDrawColor(renderer, 200, 200, 200, 255);
     SDL_RenderDrawRect(renderer, &bgRect);
 
-    static TTF_Font* ammoFont = TTF_OpenFont("BitcountGridDouble.ttf", 18);
-    if (ammoFont) {
-        char ammoText[32];
-        std::snprintf(ammoText, sizeof(ammoText), "%d/%d", currentAmmo, magSize);
-
-        SDL_Color textColor = {255, 255, 255, 255};
-        SDL_Surface* ammoTextSurface = TTF_RenderText_Solid(ammoFont, ammoText, textColor);
-        if (ammoTextSurface) {
-            SDL_Texture* textTexture = SDL_CreateTextureFromSurface(renderer, ammoTextSurface);
-            if (textTexture) {
-                SDL_Rect textRect;
-                textRect.w = ammoTextSurface->w;
-                textRect.h = ammoTextSurface->h;
-                textRect.x = x + (barWidth - textRect.w) / 2;
-                textRect.y = y + (barHeight - textRect.h) / 2;
-                SDL_RenderCopy(renderer, textTexture, nullptr, &textRect);
-                SDL_DestroyTexture(textTexture);
-            }
-            SDL_FreeSurface(ammoTextSurface);
-        }
+    char ammoText[32];
+    std::snprintf(ammoText, sizeof(ammoText), "%d/%d", currentAmmo, magSize);
 
-        if (reloading) {
-            static TTF_Font* reloadFont = TTF_OpenFont("BitcountGridDouble.ttf", 14);
-            if (reloadFont) {
-                SDL_Color reloadColor = {255, 165, 0, 255};
-                SDL_Surface* reloadSurface = TTF_RenderText_Solid(reloadFont, "RELOADING", reloadColor);
-                if (reloadSurface) {
-                    SDL_Texture* reloadTexture = SDL_CreateTextureFromSurface(renderer, reloadSurface);
-                    if (reloadTexture) {
-                        SDL_Rect reloadRect;
-                        reloadRect.w = reloadSurface->w;
-                        reloadRect.h = reloadSurface->h;
-                        reloadRect.x = x + (barWidth - reloadRect.w) / 2;
-                        reloadRect.y = y - reloadRect.h - 4;
-                        SDL_RenderCopy(renderer, reloadTexture, nullptr, &reloadRect);
-                        SDL_DestroyTexture(reloadTexture);
-                    }
-                    SDL_FreeSurface(reloadSurface);
-                }
-            }
-        }
+    int textW, textH;
+    hudText.MeasureText(ammoText, textW, textH);
+    hudText.Draw(ammoText, x + (barWidth - textW) / 2, y + (barHeight - textH) / 2, SDL_Color{255, 255, 255, 255});
+
+    if (reloading) {
+        int reloadW, reloadH;
+        smallText.MeasureCached("RELOADING", reloadW, reloadH);
+        smallText.DrawCached("RELOADING", x + (barWidth - reloadW) / 2, y - reloadH - 4, SDL_Color{255, 165, 0, 255});
     }
 }
 
 void Game::DisplayTimer() {
-    static TTF_Font* timerFont = TTF_OpenFont("BitcountGridDouble.ttf", 18);
-    if (!timerFont) {
-        timerFont = TTF_OpenFont("SDL/BitcountGridDouble.ttf", 18);
-        if (!timerFont) {
-            timerFont = TTF_OpenFont("../SDL/BitcountGridDouble.ttf", 18);
-        }
-        if (!timerFont) {
-            return;
-        }
-    }
-    char timerText[64];
-    std::snprintf(timerText, sizeof(timerText), "Time: %.1f", levelTimer);
-
-    SDL_Color textColor = {255, 255, 255, 255};
-    SDL_Surface* timerSurface = TTF_RenderText_Solid(timerFont, timerText, textColor);
-    if (!timerSurface) {
+    if (!hudText.IsLoaded()) {
         return;
     }
+    char timerText[64];
+    std::snprintf(timerText, sizeof(timerText), "Time: %.1f", frame->levelTimer);
 
-    SDL_Texture* timerTexture = SDL_CreateTextureFromSurface(renderer, timerSurface);
-    if (!timerTexture) {
-        SDL_FreeSurface(timerSurface);
-        return;
-    }
+    int textW, textH;
+    hudText.MeasureText(timerText, textW, textH);
 
     const int padding = 10;
-    SDL_Rect bgRect = {screenWidth - timerSurface->w - padding - 16, padding - 4, timerSurface->w + 12, timerSurface->h + 8};
+    SDL_Rect bgRect = {screenWidth - textW - padding - 16, padding - 4, textW + 12, textH + 8};
     SDL_SetRenderDrawColor(renderer, 40, 40, 40, 200);
     SDL_RenderFillRect(renderer, &bgRect);
 
-    SDL_Rect textRect = {screenWidth - timerSurface->w - padding - 16, padding, timerSurface->w, timerSurface->h};
-    SDL_RenderCopy(renderer, timerTexture, nullptr, &textRect);
-
-    SDL_DestroyTexture(timerTexture);
-    SDL_FreeSurface(timerSurface);
+    hudText.Draw(timerText, screenWidth - textW - padding - 16, padding, SDL_Color{255, 255, 255, 255});
 }
 
 
 void Game::DisplayScore() {
-    static TTF_Font* scoreFont = TTF_OpenFont("BitcountGridDouble.ttf", 18);
-    if (!scoreFont) {
+    if (!hudText.IsLoaded()) {
         return;
     }
 
     // Display current score and dynamic high score (current score if beating the record)
+    int score = frame->score;
     int displayHighScore = (score > highScore) ? score : highScore;
     char scoreText[64];
     std::snprintf(scoreText, sizeof(scoreText), "Score: %d  |  High: %d", score, displayHighScore);
 
-    SDL_Color textColor = {255, 255, 255, 255};
-    SDL_Surface* scoreSurface = TTF_RenderText_Solid(scoreFont, scoreText, textColor);
-    if (!scoreSurface) {
+    int textW, textH;
+    hudText.MeasureText(scoreText, textW, textH);
+
+    const int padding = 10;
+    SDL_Rect bgRect = {padding - 6, padding - 4, textW + 12, textH + 8};
+    SDL_SetRenderDrawColor(renderer, 40, 40, 40, 200);
+    SDL_RenderFillRect(renderer, &bgRect);
+
+    hudText.Draw(scoreText, padding, padding, SDL_Color{255, 255, 255, 255});
+}
+
+void Game::DisplayRenderStats() {
+    if (!smallText.IsLoaded()) {
         return;
     }
 
-    SDL_Texture* scoreTexture = SDL_CreateTextureFromSurface(renderer, scoreSurface);
-    if (!scoreTexture) {
-        SDL_FreeSurface(scoreSurface);
+    char statsText[128];
+    std::snprintf(statsText, sizeof(statsText), "Map draw calls: %d  |  Chunks: %d  |  Sprite batches: %d (%d quads)",
+                  mapLayer.GetDrawCalls(), mapLayer.GetCachedChunkCount(),
+                  spriteBatch.GetDrawCalls(), spriteBatch.GetQuadCount());
+
+    int textW, textH;
+    smallText.MeasureText(statsText, textW, textH);
+
+    const int padding = 10;
+    int textY = screenHeight - padding - textH;
+    SDL_Rect bgRect = {padding - 6, textY - 4, textW + 12, textH + 8};
+    SDL_SetRenderDrawColor(renderer, 40, 40, 40, 200);
+    SDL_RenderFillRect(renderer, &bgRect);
+
+    smallText.Draw(statsText, padding, textY, SDL_Color{255, 255, 255, 255});
+}
+
+void Game::DisplayProfiler() {
+    if (!smallText.IsLoaded()) {
         return;
     }
 
+    // avg / p99 / min over the profiler's rolling window, plus last frame's
+    // heap allocations when a build with allocation hooks is counting them
+    Profiler& profiler = Profiler::Get();
+    AllocTracker& allocations = AllocTracker::Get();
+    bool showAllocations = allocations.IsInstalled();
+    int lineHeight = smallText.GetLineHeight() + 2;
+    int sectionCount = profiler.GetSectionCount();
+    int rowCount = sectionCount + (showAllocations ? 1 : 0);
     const int padding = 10;
-    SDL_Rect bgRect = {padding - 6, padding - 4, scoreSurface->w + 12, scoreSurface->h + 8};
-    SDL_SetRenderDrawColor(renderer, 40, 40, 40, 200);
+    int top = 44;
+    SDL_Rect bgRect = {padding - 6, top - 4, showAllocations ? 400 : 330, (rowCount + 1) * lineHeight + 8};
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 20, 20, 20, 200);
     SDL_RenderFillRect(renderer, &bgRect);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
 
-    SDL_Rect textRect = {padding, padding, scoreSurface->w, scoreSurface->h};
-    SDL_RenderCopy(renderer, scoreTexture, nullptr, &textRect);
+    SDL_Color headerColor = {255, 220, 120, 255};
+    SDL_Color rowColor = {255, 255, 255, 255};
+    if (showAllocations) {
+        smallText.DrawCached("section        avg    p99    min  (ms) allocs", padding, top, headerColor);
+    } else {
+        smallText.DrawCached("section        avg    p99    min  (ms)", padding, top, headerColor);
+    }
+    for (int i = 0; i < sectionCount; i++) {
+        Profiler::SectionStats stats = profiler.GetStats(i);
+        char line[96];
+        if (showAllocations) {
+            std::snprintf(line, sizeof(line), "%-14s %6.2f %6.2f %6.2f %10lld", stats.name, stats.avgMs, stats.p99Ms, stats.minMs,
+                          allocations.GetStats(i).lastFrame);
+        } else {
+            std::snprintf(line, sizeof(line), "%-14s %6.2f %6.2f %6.2f", stats.name, stats.avgMs, stats.p99Ms, stats.minMs);
+        }
+        smallText.Draw(line, padding, top + (i + 1) * lineHeight, rowColor);
+    }
+    if (showAllocations) {
+        char line[96];
+        std::snprintf(line, sizeof(line), "%-14s %31lld", "other", allocations.GetStats(AllocTracker::otherSubsystem).lastFrame);
+        smallText.Draw(line, padding, top + rowCount * lineHeight, rowColor);
+    }
+}
 
-    SDL_DestroyTexture(scoreTexture);
-    SDL_FreeSurface(scoreSurface);
+void Game::PrintAllocationReport() const {
+    const AllocTracker& allocations = AllocTracker::Get();
+    int frames = allocations.GetFrameCount();
+    if (!allocations.IsInstalled() || frames == 0) {
+        return;
+    }
+    printf("Heap allocations over %d frames (new: %lld, SDL: %lld)\n", frames,
+           allocations.GetTotalAllocations(AllocTracker::NEW), allocations.GetTotalAllocations(AllocTracker::SDL_MALLOC));
+    printf("%-16s %10s %10s %12s\n", "subsystem", "per frame", "peak", "bytes");
+    for (int i = 0; i < AllocTracker::subsystemCount; i++) {
+        AllocTracker::SubsystemStats stats = allocations.GetStats(i);
+        if (!stats.name || stats.total == 0) {
+            continue;
+        }
+        printf("%-16s %10.2f %10lld %12lld\n", stats.name, (double)stats.total / frames, stats.peakFrame, stats.totalBytes);
+    }
 }
 
 void Game::LoadHighScore() {
@@ -1582,8 +1285,8 @@ void Game::LoadHighScore() {
 }
 
 void Game::SaveHighScore() {
-    if (score > highScore) {
-        highScore = score;
+    if (world.GetScore() > highScore) {
+        highScore = world.GetScore();
         std::ofstream file("highscore.txt");
         if (file.is_open()) {
             file << highScore;
@@ -1601,7 +1304,7 @@ void Game::ResetHighScore() {
     }
 }
 
-void Game::RenderBreakingWallEffect(float worldX, float worldY, float life01) const {
+void Game::RenderBreakingWallEffect(float worldX, float worldY, float life01) {
     int size = (int)(tileSize * (1.0f + 0.7f * (1.0f - life01)));
     int centerX = (int)(worldX - cameraX);
     int centerY = (int)(worldY - cameraY);
@@ -1615,10 +1318,7 @@ void Game::RenderBreakingWallEffect(float worldX, float worldY, float life01) co
     Uint8 baseG = 200;
     Uint8 baseB = 80;
     Uint8 alpha = (Uint8)(255.0f * std::clamp(life01, 0.0f, 1.0f));
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-    SDL_SetRenderDrawColor(renderer, baseR, baseG, baseB, alpha);
-    SDL_RenderFillRect(renderer, &breakingWallRect);
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    spriteBatch.AddRect(breakingWallRect, SDL_Color{baseR, baseG, baseB, alpha}, SpriteBatch::LAYER_GROUND);
 }
 
 
@@ -1630,77 +1330,49 @@ void Game::RenderGameOver() {
     menu->Render("Game Over! Press ENTER", screenWidth, screenHeight);
 
     // Render score info
-    static TTF_Font* scoreFont = TTF_OpenFont("BitcountGridDouble.ttf", 24);
-    if (scoreFont) {
-        char scoreText[96];
-        std::snprintf(scoreText, sizeof(scoreText), "Score: %d  |  High Score: %d", score, highScore);
-
-        SDL_Color textColor = {255, 255, 255, 255};
-        SDL_Surface* scoreSurface = TTF_RenderText_Solid(scoreFont, scoreText, textColor);
-        if (scoreSurface) {
-            SDL_Texture* scoreTexture = SDL_CreateTextureFromSurface(renderer, scoreSurface);
-            if (scoreTexture) {
-                SDL_Rect scoreRect = {
-                    (screenWidth - scoreSurface->w) / 2,
-                    screenHeight / 2 + 80,
-                    scoreSurface->w,
-                    scoreSurface->h
-                };
-                SDL_RenderCopy(renderer, scoreTexture, nullptr, &scoreRect);
-                SDL_DestroyTexture(scoreTexture);
-            }
-            SDL_FreeSurface(scoreSurface);
-        }
-    }
+    char scoreText[96];
+    std::snprintf(scoreText, sizeof(scoreText), "Score: %d  |  High Score: %d", world.GetScore(), highScore);
+    int scoreW, scoreH;
+    largeText.MeasureText(scoreText, scoreW, scoreH);
+    largeText.Draw(scoreText, (screenWidth - scoreW) / 2, screenHeight / 2 + 80, SDL_Color{255, 255, 255, 255});
 
     // Render reset instruction
-    static TTF_Font* smallFont = TTF_OpenFont("BitcountGridDouble.ttf", 14);
-    if (smallFont) {
-        SDL_Color smallColor = {150, 150, 150, 255};
-        SDL_Surface* resetSurface = TTF_RenderText_Solid(smallFont, "Press G to reset high score", smallColor);
-        if (resetSurface) {
-            SDL_Texture* resetTexture = SDL_CreateTextureFromSurface(renderer, resetSurface);
-            if (resetTexture) {
-                SDL_Rect resetRect = {
-                    (screenWidth - resetSurface->w) / 2,
-                    screenHeight / 2 + 140,
-                    resetSurface->w,
-                    resetSurface->h
-                };
-                SDL_RenderCopy(renderer, resetTexture, nullptr, &resetRect);
-                SDL_DestroyTexture(resetTexture);
-            }
-            SDL_FreeSurface(resetSurface);
-        }
-    }
+    int resetW, resetH;
+    smallText.MeasureCached("Press G to reset high score", resetW, resetH);
+    smallText.DrawCached("Press G to reset high score", (screenWidth - resetW) / 2, screenHeight / 2 + 140, SDL_Color{150, 150, 150, 255});
 
     SDL_RenderPresent(renderer);
 }
 
 void Game::Clean() {
-    SDL_DestroyTexture(playerTexture);
-    SDL_DestroyTexture(playerWalkTexture1);
-    SDL_DestroyTexture(playerWalkTexture2);
-    SDL_DestroyTexture(playerPistolTexture);
-    SDL_DestroyTexture(playerShotgunTexture);
-    SDL_DestroyTexture(playerSmgTexture);
-    SDL_DestroyTexture(playerPistolWalkTexture1);
-    SDL_DestroyTexture(playerPistolWalkTexture2);
-    SDL_DestroyTexture(playerShotgunWalkTexture1);
-    SDL_DestroyTexture(playerShotgunWalkTexture2);
-    SDL_DestroyTexture(playerSmgWalkTexture1);
-    SDL_DestroyTexture(playerSmgWalkTexture2);
-    SDL_DestroyTexture(inventoryPistolTexture);
-    SDL_DestroyTexture(inventoryShotgunTexture);
-    SDL_DestroyTexture(inventorySmgTexture);
-    SDL_DestroyTexture(wallTexture);
-    SDL_DestroyTexture(floorTexture);
-    SDL_DestroyTexture(brokenWallTexture);
-    SDL_DestroyTexture(healthTexture);
-    SDL_DestroyTexture(speedTexture);
-    SDL_DestroyTexture(weaponItemsTexture);
-    Enemy::ReleaseTextures();
+    simRunner.StopThread(); // the world is ours again from here
+    PrintAllocationReport();
+    if (!profileCsvPath.empty() && !Profiler::Get().WriteCsv(profileCsvPath.c_str())) {
+        printf("Could not write profile to %s\n", profileCsvPath.c_str());
+    }
+    if (!tracePath.empty()) {
+        Tracer::Get().Stop();
+        if (!Tracer::Get().WriteJson(tracePath.c_str())) {
+            printf("Could not write trace to %s\n", tracePath.c_str());
+        }
+    }
+    if (recording && loggedRunStarted) {
+        if (inputLog.Save(recordPath.c_str())) {
+            printf("Recorded %d ticks to %s, state hash %016llx\n", inputLog.GetTickCount(), recordPath.c_str(),
+                   (unsigned long long)world.ComputeStateHash());
+        } else {
+            printf("Could not write recording to %s\n", recordPath.c_str());
+        }
+    }
+    world.SetJobSystem(nullptr);
+    jobs.Stop();
+    mapLayer.Release();
+    hudText.Release();
+    smallText.Release();
+    largeText.Release();
+    spriteAtlas.Release();
     delete menu;
+    assets.Shutdown();
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     IMG_Quit();
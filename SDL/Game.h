@@ -4,11 +4,24 @@
 #define GAME_H
 
 #include <vector>
+#include <string>
 #include "Enemy.h"
 #include <SDL2/SDL.h>
 #include "Entity.h"
 #include "Weapon.h"
 #include "Items.h"
+#include "World.h"
+#include "InputFrame.h"
+#include "SimRunner.h"
+#include "FrameSnapshot.h"
+#include "TileMap.h"
+#include "InputLog.h"
+#include "JobSystem.h"
+#include "MapLayer.h"
+#include "TextRenderer.h"
+#include "AssetManager.h"
+#include "SpriteAtlas.h"
+#include "SpriteBatch.h"
 
 class Menu;
 
@@ -22,6 +35,24 @@ class Game {
         void Update();
         void Render();
         void Clean();
+        void LimitFrameRate();
+
+        // Call before Init()
+        void SetTickRate(float ticksPerSecond);
+        void SetVSync(bool enabled);
+        void SetFrameRateCap(int framesPerSecond);
+        void SetMapSize(int mapWidth, int mapHeight);
+        void SetSeed(std::uint64_t seed); // regenerates the map and restarts level 1
+        void SetThreadCount(int threads); // sim worker threads incl. the main one; 0 = one per core
+        void SetSimThread(bool enabled); // false ticks the world on the main thread between renders
+        void SetMapCaching(bool enabled);
+        void SetShowRenderStats(bool enabled);
+        void SetShowAssetTimings(bool enabled); // print how long each asset took to load
+        void SetUseAssetPack(bool enabled); // false loads loose files even when assets.pack exists
+        void SetProfileCsvPath(const char* path); // write profiler stats here on Clean()
+        void SetTracePath(const char* path); // start tracing; trace JSON is written on Clean()
+        void SetRecordPath(const char* path); // log every tick's input; saved on Clean()
+        bool SetReplayPath(const char* path); // play a recorded log instead of reading input, then quit
         
         
     private:
@@ -32,74 +63,62 @@ class Game {
         float GetDifficultyMultiplier() const;
         GameState currentState;
         GameState previousState;
-        int currentLevel;
-        float levelTimer;
-        void UpdateTimer(float deltaTime);
         int getLevel();
         Uint32 getLastTime();
         GameState getCurrentState();
         float getDeltaTime();
 
-        // ====== Player ======
-        Entity player;
-        int playerHP;
-        int playerMaxHP;
-        float playerInvulnTimer;
-        float playerBaseSpeed;
-        float playerSpeed;
-        int playerMeleeDamage;
-
-        // ====== Enemies ======
-        std::vector<Enemy> enemies;
-        void UpdateEnemy(float deltaTime);
-        void EnemyHP();
+        // ====== Simulation ======
+        // The world only ticks inside simRunner; everything drawn comes from
+        // the latest snapshot it published. Level flow touches the world
+        // directly, and only while the runner is parked.
+        World world;
+        SimRunner simRunner;
+        bool simThreadEnabled;
+        const FrameSnapshot* frame; // latest snapshot, valid until the next AcquireSnapshot
+        JobSystem jobs;
+        int threadCount;
+        float renderAlpha; // how far between the previous and current tick we are drawing
+        int seenShotCount; // frame->shotCount the shot animation last started for
+        InputFrame PollInput();
+        Entity GetRenderPlayer() const;
+
+        // ====== Record / Replay ======
+        InputLog inputLog;
+        std::string recordPath;
+        bool recording;
+        bool replaying;
+        const char* replayEndReason; // set by the replay input source when it stops the run
+        bool loggedRunStarted; // the world has been rebuilt from the log header
+        int replayCursor;      // next inputLog entry to play
+        void BeginLoggedRun();
+        bool NextReplayTick(InputFrame& input);
+        void ApplyReplayLevelChange(InputLog::EntryKind kind);
+        void FinishReplay(const char* reason);
 
-        // ====== Bullets ======
-        std::vector<Bullet> bullets;
-        float shootCooldown;
-        
-        void UpdateBullets(float deltaTime);
-        void DetectMouseClick();
-        
         // ==== Weapons ====
-        std::vector<Weapon> playerWeapons;
-        int currentWeaponIndex = 0;
         bool inventoryOpen = false;
-        void UpdateReloadCooldown(float deltaTime);
-        void HandleReloadInput();
-
-        // ==== Items ====
-        std::vector<HealthItem> healthItems;
-        std::vector<WeaponItem> weaponItems;
-        std::vector<SpeedItem> speedItems;
-        void UpdateHealthItems();
-        void UpdateWeaponItems();
-        void UpdateSpeedItems(float deltaTime);
-
-        float speedItemDuration;
-        float speedItemTimer;
-        float speedItemAmount;
-        bool speedItemActive;
+        void HandleInventoryInput(InputFrame& input);
+        void HandleReloadInput(InputFrame& input);
 
-        
         // ====== Map ======
-        static const int mapWidth = 16;
-        static const int mapHeight = 16;
-        int map[mapWidth * mapHeight];
         int tileSize;
-        int tileHP[mapWidth * mapHeight];
-        
+        MapLayer mapLayer;
+        int mapLayerRevision; // world map revision the layer was last baked from
+        TileMap renderMap;    // the map as drawn; patched from snapshot tile edits
+        std::uint64_t appliedTileSerial; // newest snapshot tile edit applied to renderMap
+
+        void SyncRenderMap(); // copy the world's map while the runner is parked
+        void ApplyTileEdits();
+
         void DrawMap();
         void DrawBreakingWall();
-        void DrawTile(int x, int y);
-        void DamageTileAtWorld(float worldX, float worldY, int damage);
-        bool DetectCollision(const Entity& entity, float nextX, float nextY);
-        void UpdateBreakingWallTime(float deltaTime);
-        
+        void EnemyHP();
+
         // ====== Camera ======
         int cameraX;
         int cameraY;
-        void UpdateCamera(float deltaTime, float dx, float dy);
+        void UpdateCamera();
         void UpdateClamp();
 
         // ====== Animation ======
@@ -112,32 +131,21 @@ class Game {
         float playerWalkAnimTimer;
         float playerWalkFrameDuration;
         int playerWalkFrameIndex;
-        bool playerDying;
-        float playerDeathTimer; // time left for player death animation, used to show death animation and prevent input during it
-        float playerDeathDuration;
-        // ====== Breaking Wall Effects ======
-        struct WallBreakEffect {
-            float worldX, worldY;
-            float timer;
-        };
-        std::vector<WallBreakEffect> wallBreakEffects;
-        float breakingWallDuration;
-        
-        // ====== Game Systems ======
-        void UpdateGame(float deltaTime, float dx, float dy);
-        
+        void UpdatePlayerAnimation(float deltaTime);
+
         // ====== Player Systems ======
-        void HandlePlayerInput(float deltaTime, float &dx, float &dy);
-        void HandlePlayerMovementInput(float deltaTime, float &dx, float &dy);
-        void HandleInventoryInput();
-        void UpdateWeaponCooldown(float deltaTime);
-        void UpdatePlayer(float deltaTime);
-        void UpdateCollision(float deltaTime, float dx, float dy);
+        void HandlePlayerMovementInput(InputFrame& input);
         void PlayerHP();
         void DisplayAmmo();
         void DisplayTimer();
         void DisplayScore();
-        void AddKillScore(int kills);
+        void DisplayRenderStats();
+        void DisplayProfiler();
+        void PrintAllocationReport() const; // only when allocation hooks are linked in
+        AssetManager assets; // declared first so it outlives everything holding its fonts
+        TextRenderer hudText; // glyph atlases, built once in Init
+        TextRenderer smallText;
+        TextRenderer largeText;
         void LoadHighScore();
         void SaveHighScore();
         void ResetHighScore();
@@ -146,6 +154,7 @@ class Game {
         void UpdateMenu();
         void UpdateOptionsMenu();
         void UpdatePlayingGameState(float deltaTime);
+        void ApplyWorldStatus(World::Status status);
         void UpdateLevelComplete();
         void UpdateGameOver();
         void HandlePauseInput();
@@ -154,41 +163,33 @@ class Game {
         void RenderOptionsMenu();
         void RenderPauseMenu();
         void RenderGameScene();
+        void DrawPlayer();
+        void DrawItems();
+        void DrawBullets();
+        void DrawInventory();
         void RenderGame();
         void RenderLevelComplete();
-        void RenderBreakingWallEffect(float worldX, float worldY, float life01) const;
+        void RenderBreakingWallEffect(float worldX, float worldY, float life01);
         void RenderGameOver();
 
         // ====== SDL ======
         SDL_Window* window;
         SDL_Renderer* renderer;
-        SDL_Texture* playerTexture;
-        SDL_Texture* playerWalkTexture1;
-        SDL_Texture* playerWalkTexture2;
-        SDL_Texture* playerPistolTexture;
-        SDL_Texture* playerShotgunTexture;
-        SDL_Texture* playerSmgTexture;
-        SDL_Texture* playerPistolWalkTexture1;
-        SDL_Texture* playerPistolWalkTexture2;
-        SDL_Texture* playerShotgunWalkTexture1;
-        SDL_Texture* playerShotgunWalkTexture2;
-        SDL_Texture* playerSmgWalkTexture1;
-        SDL_Texture* playerSmgWalkTexture2;
-        SDL_Texture* inventoryPistolTexture;
-        SDL_Texture* inventoryShotgunTexture;
-        SDL_Texture* inventorySmgTexture;
-        SDL_Texture* wallTexture;
-        SDL_Texture* floorTexture;
-        SDL_Texture* brokenWallTexture;
-        SDL_Texture* healthTexture;
-        SDL_Texture* speedTexture;
-        SDL_Texture* weaponItemsTexture;
+        SpriteAtlas spriteAtlas; // every game sprite in one texture
+        SpriteBatch spriteBatch;
         bool running;
         Uint32 lastTime;
+        bool vsyncEnabled;
+        int frameRateCap;
+        Uint64 lastFrameCounter;
+        bool showRenderStats;
+        bool showAssetTimings;
+        bool useAssetPack;
+        bool showProfiler; // toggled with F3
+        std::string profileCsvPath;
+        std::string tracePath;
         int screenWidth;
         int screenHeight;
-        int bonusTime;
-        int score;
         int highScore;
         bool highScoreResetInGameOver;
 
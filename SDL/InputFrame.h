@@ -0,0 +1,18 @@
+// InputFrame.h
+#ifndef INPUT_FRAME_H
+#define INPUT_FRAME_H
+
+// Player input for one simulation step. The front end samples keyboard and
+// mouse into this so World never has to poll SDL itself.
+struct InputFrame {
+    float moveX = 0.0f;
+    float moveY = 0.0f;
+    float aimX = 0.0f; // aim point in world coordinates
+    float aimY = 0.0f;
+    bool firePressed = false;
+    bool meleePressed = false;
+    bool reloadPressed = false; // only true on the step the key went down
+    int selectWeaponSlot = -1;  // -1 keeps the current weapon
+};
+
+#endif // INPUT_FRAME_H
@@ -0,0 +1,256 @@
+//InputLog.cpp
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include "Config.h"
+#include "InputLog.h"
+#include "World.h"
+
+namespace {
+const char magic[4] = {'F', 'P', 'S', 'R'};
+const std::uint32_t formatVersion = 1;
+
+enum TickFlags : std::uint8_t { FLAG_FIRE = 1, FLAG_MELEE = 2, FLAG_RELOAD = 4 };
+
+// Fixed little-endian layout so logs move between machines.
+void PutU32(std::vector<unsigned char>& out, std::uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        out.push_back((unsigned char)(value >> (8 * i)));
+    }
+}
+
+void PutU64(std::vector<unsigned char>& out, std::uint64_t value) {
+    PutU32(out, (std::uint32_t)value);
+    PutU32(out, (std::uint32_t)(value >> 32));
+}
+
+void PutFloat(std::vector<unsigned char>& out, float value) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    PutU32(out, bits);
+}
+
+struct Reader {
+    const std::vector<unsigned char>& data;
+    size_t position;
+    bool ok;
+
+    bool Has(size_t size) {
+        ok = ok && position + size <= data.size();
+        return ok;
+    }
+
+    std::uint8_t U8() {
+        return Has(1) ? data[position++] : 0;
+    }
+
+    std::uint32_t U32() {
+        if (!Has(4)) {
+            return 0;
+        }
+        std::uint32_t value = 0;
+        for (int i = 0; i < 4; i++) {
+            value |= (std::uint32_t)data[position++] << (8 * i);
+        }
+        return value;
+    }
+
+    std::uint64_t U64() {
+        std::uint64_t low = U32();
+        return low | ((std::uint64_t)U32() << 32);
+    }
+
+    float Float() {
+        std::uint32_t bits = U32();
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+};
+
+// Keyboard movement is always -1, 0 or 1 per axis, so one signed byte each.
+std::int8_t PackAxis(float value) {
+    return (std::int8_t)std::lround(std::fmax(-1.0f, std::fmin(1.0f, value)) * 127.0f);
+}
+
+float UnpackAxis(std::int8_t value) {
+    return value / 127.0f;
+}
+}
+
+void InputLog::Begin(const Header& header) {
+    this->header = header;
+    entries.clear();
+    tickCount = 0;
+}
+
+const InputLog::Header& InputLog::GetHeader() const {
+    return header;
+}
+
+void InputLog::AddTick(const InputFrame& input) {
+    Entry entry;
+    entry.kind = TICK;
+    entry.input = input;
+    entry.difficultyMultiplier = 0.0f;
+    entries.push_back(entry);
+    tickCount++;
+}
+
+void InputLog::AddNextLevel(float difficultyMultiplier) {
+    entries.push_back({NEXT_LEVEL, InputFrame(), difficultyMultiplier});
+}
+
+void InputLog::AddRestart(float difficultyMultiplier) {
+    entries.push_back({RESTART, InputFrame(), difficultyMultiplier});
+}
+
+int InputLog::GetEntryCount() const {
+    return (int)entries.size();
+}
+
+const InputLog::Entry& InputLog::GetEntry(int index) const {
+    return entries[index];
+}
+
+int InputLog::GetTickCount() const {
+    return tickCount;
+}
+
+void InputLog::PrepareWorld(World& world) const {
+    world.SetMapSize(header.mapWidth, header.mapHeight);
+    world.SetSeed(header.seed);
+    world.GenerateMap(header.spawnX, header.spawnY);
+    world.Restart(header.difficultyMultiplier);
+}
+
+int InputLog::RunHeadless(World& world) const {
+    PrepareWorld(world);
+    for (const Entry& entry : entries) {
+        if (entry.kind == TICK) {
+            world.Step(header.stepSize, entry.input);
+        } else if (entry.kind == NEXT_LEVEL) {
+            world.StartNextLevel(entry.difficultyMultiplier);
+        } else {
+            world.Restart(entry.difficultyMultiplier);
+        }
+    }
+    return tickCount;
+}
+
+bool InputLog::Save(const char* path) const {
+    std::vector<unsigned char> data;
+    data.reserve(64 + entries.size() * 13);
+    data.insert(data.end(), magic, magic + 4);
+    PutU32(data, formatVersion);
+    PutU64(data, header.seed);
+    PutU32(data, (std::uint32_t)header.mapWidth);
+    PutU32(data, (std::uint32_t)header.mapHeight);
+    PutFloat(data, header.spawnX);
+    PutFloat(data, header.spawnY);
+    PutFloat(data, header.stepSize);
+    PutFloat(data, header.difficultyMultiplier);
+    PutU32(data, (std::uint32_t)entries.size());
+
+    for (const Entry& entry : entries) {
+        data.push_back(entry.kind);
+        if (entry.kind != TICK) {
+            PutFloat(data, entry.difficultyMultiplier);
+            continue;
+        }
+        const InputFrame& input = entry.input;
+        std::uint8_t flags = 0;
+        flags |= input.firePressed ? FLAG_FIRE : 0;
+        flags |= input.meleePressed ? FLAG_MELEE : 0;
+        flags |= input.reloadPressed ? FLAG_RELOAD : 0;
+        data.push_back(flags);
+        data.push_back((unsigned char)PackAxis(input.moveX));
+        data.push_back((unsigned char)PackAxis(input.moveY));
+        data.push_back((unsigned char)(std::int8_t)input.selectWeaponSlot);
+        PutFloat(data, input.aimX);
+        PutFloat(data, input.aimY);
+    }
+
+    FILE* file = std::fopen(path, "wb");
+    if (!file) {
+        return false;
+    }
+    bool written = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+    std::fclose(file);
+    return written;
+}
+
+bool InputLog::Load(const char* path) {
+    Begin(Header());
+    FILE* file = std::fopen(path, "rb");
+    if (!file) {
+        return false;
+    }
+    std::vector<unsigned char> data;
+    unsigned char buffer[4096];
+    size_t count;
+    while ((count = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        data.insert(data.end(), buffer, buffer + count);
+    }
+    std::fclose(file);
+
+    Reader reader = {data, 0, true};
+    if (!reader.Has(4) || std::memcmp(data.data(), magic, 4) != 0) {
+        return false;
+    }
+    reader.position = 4;
+    if (reader.U32() != formatVersion) {
+        return false;
+    }
+    Header loaded;
+    loaded.seed = reader.U64();
+    loaded.mapWidth = (int)reader.U32();
+    loaded.mapHeight = (int)reader.U32();
+    loaded.spawnX = reader.Float();
+    loaded.spawnY = reader.Float();
+    loaded.stepSize = reader.Float();
+    loaded.difficultyMultiplier = reader.Float();
+    std::uint32_t entryCount = reader.U32();
+    if (!reader.ok) {
+        return false;
+    }
+    // World and SimRunner would quietly clamp or ignore these and the replay
+    // would run at another step or size than it was recorded with
+    bool stepValid = std::isfinite(loaded.stepSize) && loaded.stepSize > 0.0f;
+    bool mapValid = loaded.mapWidth >= MIN_MAP_SIZE && loaded.mapWidth <= MAX_MAP_SIZE
+        && loaded.mapHeight >= MIN_MAP_SIZE && loaded.mapHeight <= MAX_MAP_SIZE;
+    if (!stepValid || !mapValid) {
+        return false;
+    }
+    Begin(loaded);
+
+    for (std::uint32_t i = 0; i < entryCount && reader.ok; i++) {
+        std::uint8_t kind = reader.U8();
+        if (kind == NEXT_LEVEL || kind == RESTART) {
+            float difficultyMultiplier = reader.Float();
+            entries.push_back({(EntryKind)kind, InputFrame(), difficultyMultiplier});
+            continue;
+        }
+        if (kind != TICK) {
+            reader.ok = false;
+            break;
+        }
+        InputFrame input;
+        std::uint8_t flags = reader.U8();
+        input.firePressed = (flags & FLAG_FIRE) != 0;
+        input.meleePressed = (flags & FLAG_MELEE) != 0;
+        input.reloadPressed = (flags & FLAG_RELOAD) != 0;
+        input.moveX = UnpackAxis((std::int8_t)reader.U8());
+        input.moveY = UnpackAxis((std::int8_t)reader.U8());
+        input.selectWeaponSlot = (std::int8_t)reader.U8();
+        input.aimX = reader.Float();
+        input.aimY = reader.Float();
+        AddTick(input);
+    }
+    if (!reader.ok) {
+        Begin(Header());
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,58 @@
+// InputLog.h
+#ifndef INPUT_LOG_H
+#define INPUT_LOG_H
+
+#include <cstdint>
+#include <vector>
+#include "InputFrame.h"
+
+class World;
+
+// Every InputFrame fed to World::Step, plus the level changes between them,
+// so a session can be replayed tick for tick. The header holds what is needed
+// to rebuild the starting World. Saved as a little-endian binary file of
+// 13 bytes per tick.
+class InputLog {
+    public:
+        enum EntryKind : std::uint8_t { TICK = 0, NEXT_LEVEL = 1, RESTART = 2 };
+
+        struct Header {
+            std::uint64_t seed = 0;
+            int mapWidth = 0;
+            int mapHeight = 0;
+            float spawnX = 0.0f;
+            float spawnY = 0.0f;
+            float stepSize = 0.0f;
+            float difficultyMultiplier = 1.0f;
+        };
+
+        struct Entry {
+            EntryKind kind;
+            InputFrame input;           // TICK only
+            float difficultyMultiplier; // NEXT_LEVEL and RESTART only
+        };
+
+        void Begin(const Header& header); // drops any earlier entries
+        const Header& GetHeader() const;
+        void AddTick(const InputFrame& input);
+        void AddNextLevel(float difficultyMultiplier);
+        void AddRestart(float difficultyMultiplier);
+        int GetEntryCount() const;
+        const Entry& GetEntry(int index) const;
+        int GetTickCount() const;
+
+        // Sizes the map, seeds it and restarts level 1, as at the start of the recording.
+        void PrepareWorld(World& world) const;
+        // Prepares the world and runs every entry without any timing; returns the ticks run.
+        int RunHeadless(World& world) const;
+
+        bool Save(const char* path) const;
+        bool Load(const char* path); // false (and empty) on a missing or malformed file
+
+    private:
+        Header header;
+        std::vector<Entry> entries;
+        int tickCount = 0;
+};
+
+#endif // INPUT_LOG_H
@@ -0,0 +1,148 @@
+// JobSystem.cpp
+
+#include "JobSystem.h"
+
+JobSystem::JobSystem() : deques(1) {
+    generation = 0;
+    stopping = false;
+    rangeFn = nullptr;
+    rangeContext = nullptr;
+    rangesLeft = 0;
+    stealCount = 0;
+}
+
+JobSystem::~JobSystem() {
+    Stop();
+}
+
+void JobSystem::Start(int threadCount) {
+    Stop();
+    if (threadCount <= 0) {
+        threadCount = (int)std::thread::hardware_concurrency();
+    }
+    if (threadCount < 1) {
+        threadCount = 1;
+    }
+    deques = std::vector<Deque>(threadCount);
+    stealCount = 0;
+    stopping = false;
+    for (int i = 1; i < threadCount; i++) {
+        workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+    }
+}
+
+void JobSystem::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+    deques = std::vector<Deque>(1);
+}
+
+int JobSystem::GetThreadCount() const {
+    return (int)deques.size();
+}
+
+int JobSystem::GetStealCount() const {
+    return stealCount.load();
+}
+
+void JobSystem::Run(int count, int grainSize, RangeFn fn, void* context) {
+    if (count <= 0) {
+        return;
+    }
+    if (grainSize < 1) {
+        grainSize = 1;
+    }
+    int threadCount = GetThreadCount();
+    int rangeCount = (count + grainSize - 1) / grainSize;
+    if (threadCount == 1 || rangeCount == 1) {
+        fn(context, 0, count);
+        return;
+    }
+
+    rangeFn = fn;
+    rangeContext = context;
+    rangesLeft = rangeCount;
+    // Thread t is dealt ranges [rangeCount * t / threadCount, rangeCount * (t + 1) / threadCount)
+    for (int t = 0; t < threadCount; t++) {
+        int first = (int)((long long)rangeCount * t / threadCount);
+        int last = (int)((long long)rangeCount * (t + 1) / threadCount);
+        Deque& deque = deques[t];
+        std::lock_guard<std::mutex> lock(deque.mutex);
+        deque.ranges.resize(last - first);
+        for (int r = first; r < last; r++) {
+            int begin = r * grainSize;
+            int end = begin + grainSize < count ? begin + grainSize : count;
+            deque.ranges[r - first] = Range{begin, end};
+        }
+        deque.head = 0;
+        deque.tail = last - first;
+    }
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        generation++;
+    }
+    wake.notify_all();
+
+    Drain(0);
+    // A worker may still be finishing a range it stole from us
+    while (rangesLeft.load(std::memory_order_acquire) > 0) {
+        std::this_thread::yield();
+    }
+}
+
+void JobSystem::WorkerLoop(int index) {
+    unsigned seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            wake.wait(lock, [&]() { return stopping || generation != seen; });
+            if (stopping) {
+                return;
+            }
+            seen = generation;
+        }
+        Drain(index);
+    }
+}
+
+void JobSystem::Drain(int index) {
+    Range range;
+    while (PopOwn(index, range) || Steal(index, range)) {
+        rangeFn(rangeContext, range.begin, range.end);
+        rangesLeft.fetch_sub(1, std::memory_order_acq_rel);
+    }
+}
+
+bool JobSystem::PopOwn(int index, Range& range) {
+    Deque& deque = deques[index];
+    std::lock_guard<std::mutex> lock(deque.mutex);
+    if (deque.head == deque.tail) {
+        return false;
+    }
+    deque.tail--;
+    range = deque.ranges[deque.tail];
+    return true;
+}
+
+bool JobSystem::Steal(int thief, Range& range) {
+    int threadCount = GetThreadCount();
+    for (int offset = 1; offset < threadCount; offset++) {
+        Deque& deque = deques[(thief + offset) % threadCount];
+        std::lock_guard<std::mutex> lock(deque.mutex);
+        if (deque.head == deque.tail) {
+            continue;
+        }
+        range = deque.ranges[deque.head];
+        deque.head++;
+        stealCount.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,76 @@
+// JobSystem.h
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed pool of worker threads for data-parallel loops. ParallelFor cuts
+// [0, count) into ranges, deals each thread a contiguous share into its
+// own deque, and lets threads that run dry steal from the front of the
+// others' deques. The calling thread works too and returns when every
+// range has run. fn must only write state owned by its range; anything
+// shared is collected per range and merged by the caller afterwards.
+// One ParallelFor at a time, from one thread; ranges must not nest.
+class JobSystem {
+    public:
+        JobSystem(); // one thread: ParallelFor runs inline until Start
+        ~JobSystem();
+
+        // threadCount includes the caller; 0 picks one per hardware thread
+        void Start(int threadCount);
+        void Stop();
+        int GetThreadCount() const;
+
+        // fn(begin, end) over ranges of at most grainSize items
+        template <typename Fn>
+        void ParallelFor(int count, int grainSize, Fn&& fn) {
+            Run(count, grainSize, &CallRange<Fn>, &fn);
+        }
+
+        int GetStealCount() const; // ranges run by a thread other than the one dealt them, since Start
+
+    private:
+        using RangeFn = void (*)(void* context, int begin, int end);
+
+        template <typename Fn>
+        static void CallRange(void* context, int begin, int end) {
+            (*static_cast<Fn*>(context))(begin, end);
+        }
+
+        struct Range {
+            int begin, end;
+        };
+
+        // Owner pops from the back, thieves take from the front.
+        // Storage is kept between loops, so a warm pool doesn't allocate.
+        struct Deque {
+            std::mutex mutex;
+            std::vector<Range> ranges;
+            int head = 0;
+            int tail = 0;
+        };
+
+        std::vector<std::thread> workers;
+        std::vector<Deque> deques; // one per thread, caller is 0
+        std::mutex wakeMutex;
+        std::condition_variable wake;
+        unsigned generation; // bumped to wake workers for a new loop
+        bool stopping;
+
+        RangeFn rangeFn;
+        void* rangeContext;
+        std::atomic<int> rangesLeft;
+        std::atomic<int> stealCount;
+
+        void Run(int count, int grainSize, RangeFn fn, void* context);
+        void WorkerLoop(int index);
+        void Drain(int index); // run own ranges, then steal until none are left
+        bool PopOwn(int index, Range& range);
+        bool Steal(int thief, Range& range);
+};
+
+#endif // JOB_SYSTEM_H
@@ -0,0 +1,253 @@
+//MapLayer.cpp
+
+#include <algorithm>
+#include "MapLayer.h"
+
+MapLayer::MapLayer() {
+    atlas = nullptr;
+    floorSrcRect = {0, 0, 0, 0};
+    cachingEnabled = true;
+    targetsChecked = false;
+    targetsSupported = false;
+    frame = 0;
+    drawCalls = 0;
+}
+
+MapLayer::~MapLayer() {
+    Release();
+}
+
+void MapLayer::SetAtlas(const SpriteAtlas& atlas) {
+    this->atlas = &atlas;
+    floorSrcRect = atlas.GetRect(SPRITE_FLOOR);
+    if (floorSrcRect.w > 2 && floorSrcRect.h > 2) {
+        floorSrcRect = {floorSrcRect.x + 1, floorSrcRect.y + 1, floorSrcRect.w - 2, floorSrcRect.h - 2};
+    }
+    Invalidate();
+}
+
+void MapLayer::SetCachingEnabled(bool enabled) {
+    cachingEnabled = enabled;
+    if (!enabled) {
+        Release();
+    }
+}
+
+void MapLayer::Invalidate() {
+    Release();
+    targetsChecked = false; // a reset renderer may answer differently
+}
+
+void MapLayer::MarkTileDirty(int tileX, int tileY) {
+    dirtyTiles.push_back({tileX, tileY});
+}
+
+void MapLayer::Release() {
+    for (Chunk& chunk : chunks) {
+        SDL_DestroyTexture(chunk.texture);
+    }
+    chunks.clear();
+    dirtyTiles.clear();
+}
+
+int MapLayer::GetDrawCalls() const {
+    return drawCalls;
+}
+
+int MapLayer::GetCachedChunkCount() const {
+    return (int)chunks.size();
+}
+
+void MapLayer::Draw(SDL_Renderer* renderer, const TileMap& tiles, int tileSize,
+                    int cameraX, int cameraY, int viewWidth, int viewHeight) {
+    drawCalls = 0;
+    frame++;
+    if (!targetsChecked) {
+        targetsSupported = SDL_RenderTargetSupported(renderer) == SDL_TRUE;
+        targetsChecked = true;
+    }
+    if (!cachingEnabled || !targetsSupported || tiles.GetWidth() <= 0 || tiles.GetHeight() <= 0) {
+        dirtyTiles.clear();
+        DrawTilesDirect(renderer, tiles, tileSize, cameraX, cameraY, viewWidth, viewHeight);
+        return;
+    }
+
+    PatchDirtyTiles(renderer, tiles, tileSize);
+
+    int chunkPixels = chunkTiles * tileSize;
+    int lastChunkX = (tiles.GetWidth() - 1) / chunkTiles;
+    int lastChunkY = (tiles.GetHeight() - 1) / chunkTiles;
+    int startChunkX = std::max(0, cameraX / chunkPixels);
+    int startChunkY = std::max(0, cameraY / chunkPixels);
+    int endChunkX = std::min(lastChunkX, (cameraX + viewWidth - 1) / chunkPixels);
+    int endChunkY = std::min(lastChunkY, (cameraY + viewHeight - 1) / chunkPixels);
+
+    for (int chunkY = startChunkY; chunkY <= endChunkY; chunkY++) {
+        for (int chunkX = startChunkX; chunkX <= endChunkX; chunkX++) {
+            Chunk* chunk = AcquireChunk(renderer, tiles, tileSize, chunkX, chunkY);
+            if (!chunk) {
+                // render targets failed on this device, stay on the per-tile path
+                targetsSupported = false;
+                Release();
+                DrawTilesDirect(renderer, tiles, tileSize, cameraX, cameraY, viewWidth, viewHeight);
+                return;
+            }
+            int tilesWide = std::min(chunkTiles, tiles.GetWidth() - chunkX * chunkTiles);
+            int tilesHigh = std::min(chunkTiles, tiles.GetHeight() - chunkY * chunkTiles);
+            SDL_Rect rect = {
+                chunkX * chunkPixels - cameraX,
+                chunkY * chunkPixels - cameraY,
+                tilesWide * tileSize,
+                tilesHigh * tileSize
+            };
+            SDL_RenderCopy(renderer, chunk->texture, nullptr, &rect);
+            drawCalls++;
+        }
+    }
+}
+
+void MapLayer::DrawTile(SDL_Renderer* renderer, int tile, const SDL_Rect& rect) {
+    SDL_Texture* texture = atlas ? atlas->GetTexture() : nullptr;
+    if (tile == 0) {
+        // floor
+        if (atlas && atlas->Has(SPRITE_FLOOR)) {
+            SDL_RenderCopy(renderer, texture, &floorSrcRect, &rect);
+        } else {
+            SDL_SetRenderDrawColor(renderer, 60, 55, 50, 255); // floor fallback
+            SDL_RenderFillRect(renderer, &rect);
+        }
+    } else if (tile == 1 || tile == 2) {
+        // border wall and random walls
+        if (atlas && atlas->Has(SPRITE_WALL)) {
+            SDL_RenderCopy(renderer, texture, &atlas->GetRect(SPRITE_WALL), &rect);
+        } else {
+            SDL_SetRenderDrawColor(renderer, 80, 90, 110, 255); //wall fallback
+            SDL_RenderFillRect(renderer, &rect);
+        }
+    } else if (tile == 3) {
+        // obstructable objects
+        if (atlas && atlas->Has(SPRITE_BROKEN_WALL)) {
+            SDL_RenderCopy(renderer, texture, &atlas->GetRect(SPRITE_BROKEN_WALL), &rect);
+        } else {
+            SDL_SetRenderDrawColor(renderer, 80, 90, 110, 255); //wall fallback
+            SDL_RenderFillRect(renderer, &rect);
+        }
+    } else {
+        return;
+    }
+    drawCalls++;
+}
+
+void MapLayer::DrawTilesDirect(SDL_Renderer* renderer, const TileMap& tiles, int tileSize,
+                               int cameraX, int cameraY, int viewWidth, int viewHeight) {
+    int startX = std::max(0, cameraX / tileSize);
+    int startY = std::max(0, cameraY / tileSize);
+    int endX = std::min(tiles.GetWidth(), (cameraX + viewWidth) / tileSize + 1);
+    int endY = std::min(tiles.GetHeight(), (cameraY + viewHeight) / tileSize + 1);
+    for (int y = startY; y < endY; y++) {
+        for (int x = startX; x < endX; x++) {
+            SDL_Rect rect = {x * tileSize - cameraX, y * tileSize - cameraY, tileSize, tileSize};
+            DrawTile(renderer, tiles.GetType(x, y), rect);
+        }
+    }
+}
+
+MapLayer::Chunk* MapLayer::FindChunk(int chunkX, int chunkY) {
+    for (Chunk& chunk : chunks) {
+        if (chunk.chunkX == chunkX && chunk.chunkY == chunkY) {
+            return &chunk;
+        }
+    }
+    return nullptr;
+}
+
+MapLayer::Chunk* MapLayer::AcquireChunk(SDL_Renderer* renderer, const TileMap& tiles, int tileSize, int chunkX, int chunkY) {
+    Chunk* chunk = FindChunk(chunkX, chunkY);
+    if (chunk) {
+        chunk->lastUsed = frame;
+        return chunk;
+    }
+
+    if ((int)chunks.size() >= maxCachedChunks) {
+        // evict the least recently drawn chunk, never one already on screen this frame
+        auto oldest = std::min_element(chunks.begin(), chunks.end(),
+            [](const Chunk& a, const Chunk& b) { return a.lastUsed < b.lastUsed; });
+        if (oldest->lastUsed != frame) {
+            SDL_DestroyTexture(oldest->texture);
+            *oldest = chunks.back();
+            chunks.pop_back();
+        }
+    }
+
+    int tilesWide = std::min(chunkTiles, tiles.GetWidth() - chunkX * chunkTiles);
+    int tilesHigh = std::min(chunkTiles, tiles.GetHeight() - chunkY * chunkTiles);
+    SDL_Texture* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                             tilesWide * tileSize, tilesHigh * tileSize);
+    if (!texture) {
+        return nullptr;
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+
+    chunks.push_back({chunkX, chunkY, texture, frame});
+    if (!BakeChunk(renderer, tiles, tileSize, chunks.back())) {
+        SDL_DestroyTexture(texture);
+        chunks.pop_back();
+        return nullptr;
+    }
+    return &chunks.back();
+}
+
+bool MapLayer::BakeChunk(SDL_Renderer* renderer, const TileMap& tiles, int tileSize, Chunk& chunk) {
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+    if (SDL_SetRenderTarget(renderer, chunk.texture) != 0) {
+        return false;
+    }
+
+    // the screen is cleared to black under the map, so bake onto the same background
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+    SDL_RenderClear(renderer);
+
+    int firstX = chunk.chunkX * chunkTiles;
+    int firstY = chunk.chunkY * chunkTiles;
+    int endX = std::min(tiles.GetWidth(), firstX + chunkTiles);
+    int endY = std::min(tiles.GetHeight(), firstY + chunkTiles);
+    for (int y = firstY; y < endY; y++) {
+        for (int x = firstX; x < endX; x++) {
+            SDL_Rect rect = {(x - firstX) * tileSize, (y - firstY) * tileSize, tileSize, tileSize};
+            DrawTile(renderer, tiles.GetType(x, y), rect);
+        }
+    }
+
+    SDL_SetRenderTarget(renderer, previousTarget);
+    return true;
+}
+
+void MapLayer::PatchDirtyTiles(SDL_Renderer* renderer, const TileMap& tiles, int tileSize) {
+    if (dirtyTiles.empty()) {
+        return;
+    }
+
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+    for (const DirtyTile& dirty : dirtyTiles) {
+        if (!tiles.InBounds(dirty.x, dirty.y)) {
+            continue;
+        }
+        // chunks that aren't cached will bake the new tile when they're next needed
+        Chunk* chunk = FindChunk(dirty.x / chunkTiles, dirty.y / chunkTiles);
+        if (!chunk || SDL_SetRenderTarget(renderer, chunk->texture) != 0) {
+            continue;
+        }
+        SDL_Rect rect = {
+            (dirty.x % chunkTiles) * tileSize,
+            (dirty.y % chunkTiles) * tileSize,
+            tileSize,
+            tileSize
+        };
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+        SDL_RenderFillRect(renderer, &rect);
+        drawCalls++;
+        DrawTile(renderer, tiles.GetType(dirty.x, dirty.y), rect);
+    }
+    SDL_SetRenderTarget(renderer, previousTarget);
+    dirtyTiles.clear();
+}
@@ -0,0 +1,63 @@
+// MapLayer.h
+#ifndef MAP_LAYER_H
+#define MAP_LAYER_H
+
+#include <vector>
+#include <SDL2/SDL.h>
+#include "TileMap.h"
+#include "SpriteAtlas.h"
+
+// Draws the tile map from render-target textures baked in chunkTiles x chunkTiles
+// blocks, so a frame costs one copy per visible chunk instead of one per tile.
+// Chunks bake lazily when they first come into view and the least recently used
+// ones are evicted past maxCachedChunks. Tiles changed in play are patched in
+// place with MarkTileDirty; a new map or lost render targets need Invalidate().
+class MapLayer {
+    public:
+        static constexpr int chunkTiles = 16;
+        static constexpr int maxCachedChunks = 16; // 800px chunks, so a screen needs at most four
+
+        MapLayer();
+        ~MapLayer();
+
+        void SetAtlas(const SpriteAtlas& atlas);
+        void SetCachingEnabled(bool enabled); // false draws every tile directly, for comparison
+        void Invalidate();
+        void MarkTileDirty(int tileX, int tileY);
+        void Draw(SDL_Renderer* renderer, const TileMap& tiles, int tileSize,
+                  int cameraX, int cameraY, int viewWidth, int viewHeight);
+        void Release();
+
+        int GetDrawCalls() const; // map draw calls issued by the last Draw, bakes included
+        int GetCachedChunkCount() const;
+
+    private:
+        struct Chunk {
+            int chunkX, chunkY;
+            SDL_Texture* texture;
+            unsigned lastUsed;
+        };
+        struct DirtyTile {
+            int x, y;
+        };
+
+        const SpriteAtlas* atlas;
+        SDL_Rect floorSrcRect; // inset by a pixel so the floor edges don't bleed
+        bool cachingEnabled;
+        bool targetsChecked;
+        bool targetsSupported;
+        std::vector<Chunk> chunks;
+        std::vector<DirtyTile> dirtyTiles;
+        unsigned frame;
+        int drawCalls;
+
+        void DrawTile(SDL_Renderer* renderer, int tile, const SDL_Rect& rect);
+        void DrawTilesDirect(SDL_Renderer* renderer, const TileMap& tiles, int tileSize,
+                             int cameraX, int cameraY, int viewWidth, int viewHeight);
+        Chunk* FindChunk(int chunkX, int chunkY);
+        Chunk* AcquireChunk(SDL_Renderer* renderer, const TileMap& tiles, int tileSize, int chunkX, int chunkY);
+        bool BakeChunk(SDL_Renderer* renderer, const TileMap& tiles, int tileSize, Chunk& chunk);
+        void PatchDirtyTiles(SDL_Renderer* renderer, const TileMap& tiles, int tileSize);
+};
+
+#endif // MAP_LAYER_H
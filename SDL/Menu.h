@@ -6,6 +6,7 @@
 #include <string>
 #include <cstdio>
 #include <functional>
+#include "TextRenderer.h"
 
 class Menu {
 public:
@@ -26,38 +27,21 @@ public:
     };
 
     Menu(SDL_Renderer* renderer, MouseStateProvider mouseStateProvider = SDL_GetMouseState)
-        : renderer(renderer), mouseStateProvider(mouseStateProvider) {
-    if (TTF_Init() == -1) {
-        printf("TTF_Init Error: %s\n", TTF_GetError());
-    }
-    font = TTF_OpenFont("BitcountGridDouble.ttf", 28);
-    if (!font) {
-        printf("TTF_OpenFont Error: %s\n", TTF_GetError());
-    }
-}
+        : renderer(renderer), mouseStateProvider(mouseStateProvider) {}
 
     ~Menu() {
-        if (font) TTF_CloseFont(font);
-        TTF_Quit();
+        text.Release();
     }
 
-    void Render(const std::string& textContent, int screenWidth, int screenHeight) {
-        SDL_Color color = {255, 255, 255, 255}; // white
-        SDL_Surface* surface = TTF_RenderText_Solid(font, textContent.c_str(), color);
-        if (!surface) return;
-        SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-        if (!texture) {
-            SDL_FreeSurface(surface);
-            return;
-        }
+    void LoadFont(AssetManager& assets) {
+        text.Load(renderer, assets, "BitcountGridDouble.ttf", 28);
+    }
 
+    void Render(const char* textContent, int screenWidth, int screenHeight) {
+        SDL_Color color = {255, 255, 255, 255}; // white
         int w, h;
-        SDL_QueryTexture(texture, nullptr, nullptr, &w, &h);
-    SDL_Rect dstRect = { (screenWidth - w)/2, (screenHeight - h)/2, w, h };
-        SDL_RenderCopy(renderer, texture, nullptr, &dstRect);
-
-        SDL_FreeSurface(surface);
-        SDL_DestroyTexture(texture);
+        text.MeasureCached(textContent, w, h);
+        text.DrawCached(textContent, (screenWidth - w)/2, (screenHeight - h)/2, color);
     }
 
 
@@ -168,7 +152,7 @@ private:
         return x >= rect.x && x < rect.x + rect.w && y >= rect.y && y < rect.y + rect.h;
     }
 
-    void RenderButton(const std::string& textContent, const SDL_Rect &rect, bool hover) {
+    void RenderButton(const char* textContent, const SDL_Rect &rect, bool hover) {
         SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
         if (hover) {
             SDL_SetRenderDrawColor(renderer, 80, 80, 80, 220);
@@ -181,21 +165,9 @@ private:
         SDL_RenderDrawRect(renderer, &rect);
 
         SDL_Color color = hover ? SDL_Color{255, 255, 120, 255} : SDL_Color{255, 255, 255, 255};
-        SDL_Surface* surface = TTF_RenderText_Solid(font, textContent.c_str(), color);
-        if (!surface) return;
-        SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-        if (!texture) {
-            SDL_FreeSurface(surface);
-            return;
-        }
-
         int w, h;
-        SDL_QueryTexture(texture, nullptr, nullptr, &w, &h);
-        SDL_Rect dstRect = { rect.x + (rect.w - w)/2, rect.y + (rect.h - h)/2, w, h };
-        SDL_RenderCopy(renderer, texture, nullptr, &dstRect);
-
-        SDL_FreeSurface(surface);
-        SDL_DestroyTexture(texture);
+        text.MeasureCached(textContent, w, h);
+        text.DrawCached(textContent, rect.x + (rect.w - w)/2, rect.y + (rect.h - h)/2, color);
         SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
     }
 
@@ -225,7 +197,7 @@ private:
     }
 
     SDL_Renderer* renderer;
-    TTF_Font* font{nullptr};
+    TextRenderer text; // labels are static, so they all go through its string cache
     bool mouseDownLastFrame{false};
     MouseStateProvider mouseStateProvider;
 };
\ No newline at end of file
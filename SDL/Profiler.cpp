@@ -0,0 +1,128 @@
+//Profiler.cpp
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include "Profiler.h"
+
+Profiler& Profiler::Get() {
+    static Profiler profiler;
+    return profiler;
+}
+
+int Profiler::RegisterSection(const char* name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (int i = 0; i < sectionCount; i++) {
+        if (std::strcmp(sections[i].name, name) == 0) {
+            return i;
+        }
+    }
+    if (sectionCount >= maxSections) {
+        return -1;
+    }
+    Section& section = sections[sectionCount];
+    section.name = name;
+    section.frameTotal = 0.0;
+    section.hitThisFrame = false;
+    section.count = 0;
+    section.next = 0;
+    return sectionCount++;
+}
+
+void Profiler::AddTime(int section, double milliseconds) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (section < 0 || section >= sectionCount) {
+        return;
+    }
+    sections[section].frameTotal += milliseconds;
+    sections[section].hitThisFrame = true;
+}
+
+void Profiler::EndFrame() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (int i = 0; i < sectionCount; i++) {
+        Section& section = sections[i];
+        if (!section.hitThisFrame) {
+            continue;
+        }
+        section.window[section.next] = section.frameTotal;
+        section.next = (section.next + 1) % windowSize;
+        section.count = std::min(section.count + 1, windowSize);
+        section.frameTotal = 0.0;
+        section.hitThisFrame = false;
+    }
+}
+
+void Profiler::Reset() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (int i = 0; i < sectionCount; i++) {
+        sections[i].frameTotal = 0.0;
+        sections[i].hitThisFrame = false;
+        sections[i].count = 0;
+        sections[i].next = 0;
+    }
+}
+
+int Profiler::GetSectionCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return sectionCount;
+}
+
+const char* Profiler::GetSectionName(int section) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (section < 0 || section >= sectionCount) {
+        return nullptr;
+    }
+    return sections[section].name;
+}
+
+Profiler::SectionStats Profiler::GetStats(int section) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return GetStatsLocked(section);
+}
+
+Profiler::SectionStats Profiler::GetStatsLocked(int section) const {
+    SectionStats stats = {nullptr, 0, 0.0, 0.0, 0.0, 0.0};
+    if (section < 0 || section >= sectionCount) {
+        return stats;
+    }
+    const Section& source = sections[section];
+    stats.name = source.name;
+    stats.samples = source.count;
+    if (source.count == 0) {
+        return stats;
+    }
+
+    double sorted[windowSize];
+    std::copy(source.window, source.window + source.count, sorted);
+    std::sort(sorted, sorted + source.count);
+
+    double total = 0.0;
+    for (int i = 0; i < source.count; i++) {
+        total += sorted[i];
+    }
+    // nearest-rank percentile
+    int p99Rank = (int)std::ceil(0.99 * source.count) - 1;
+    stats.minMs = sorted[0];
+    stats.avgMs = total / source.count;
+    stats.p99Ms = sorted[std::clamp(p99Rank, 0, source.count - 1)];
+    stats.maxMs = sorted[source.count - 1];
+    return stats;
+}
+
+bool Profiler::WriteCsv(const char* path) const {
+    FILE* file = std::fopen(path, "w");
+    if (!file) {
+        return false;
+    }
+    std::fprintf(file, "section,frames,min_ms,avg_ms,p99_ms,max_ms\n");
+    std::lock_guard<std::mutex> lock(mutex);
+    for (int i = 0; i < sectionCount; i++) {
+        SectionStats stats = GetStatsLocked(i);
+        std::fprintf(file, "%s,%d,%.4f,%.4f,%.4f,%.4f\n",
+                     stats.name, stats.samples, stats.minMs, stats.avgMs, stats.p99Ms, stats.maxMs);
+    }
+    std::fclose(file);
+    return true;
+}
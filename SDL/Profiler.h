@@ -0,0 +1,95 @@
+// Profiler.h
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <chrono>
+#include <mutex>
+#include <vector>
+#include "Tracer.h"
+#include "AllocTracker.h"
+
+// Per-section frame timings over a rolling window of frames. Sections are
+// timed with PROFILE_SCOPE("Name"); time from every hit in a frame is summed,
+// and EndFrame() pushes the totals into the window. While the Tracer is active
+// each hit is also recorded as a slice on the timeline. Scopes may run on
+// any thread (the sim thread's time lands in whatever frame is open);
+// EndFrame and the stats are meant for the main thread. Sections also name
+// the subsystems AllocTracker splits allocations by.
+// Build with -DFPS_ENABLE_PROFILER=OFF to compile every scope away.
+class Profiler {
+    public:
+        static constexpr int windowSize = 240; // frames, about 4 seconds at 60 fps
+        static constexpr int maxSections = 32;
+
+        struct SectionStats {
+            const char* name;
+            int samples; // frames in the window that hit this section
+            double minMs;
+            double avgMs;
+            double p99Ms;
+            double maxMs;
+        };
+
+        static Profiler& Get();
+
+        int RegisterSection(const char* name); // same name gives the same id
+        void AddTime(int section, double milliseconds);
+        void EndFrame();
+        void Reset();
+
+        int GetSectionCount() const;
+        const char* GetSectionName(int section) const; // null for an unknown id
+        SectionStats GetStats(int section) const;
+        bool WriteCsv(const char* path) const;
+
+    private:
+        struct Section {
+            const char* name;
+            double frameTotal;
+            bool hitThisFrame;
+            double window[windowSize];
+            int count; // filled slots, up to windowSize
+            int next;  // ring position
+        };
+
+        Section sections[maxSections];
+        int sectionCount = 0;
+        mutable std::mutex mutex;
+
+        SectionStats GetStatsLocked(int section) const;
+};
+
+class ScopedTimer {
+    public:
+        ScopedTimer(int section, const char* name) : section(section), name(name), start(std::chrono::steady_clock::now()) {
+            previousSubsystem = AllocTracker::EnterSubsystem(section);
+        }
+        ~ScopedTimer() {
+            AllocTracker::LeaveSubsystem(previousSubsystem);
+            std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+            std::chrono::duration<double, std::milli> elapsed = end - start;
+            Profiler::Get().AddTime(section, elapsed.count());
+            Tracer::Get().AddComplete(name, start, end);
+        }
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    private:
+        int section;
+        const char* name;
+        std::chrono::steady_clock::time_point start;
+        int previousSubsystem;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#ifdef FPS_PROFILER_ENABLED
+#define PROFILE_SCOPE(name) \
+    static const int PROFILE_CONCAT(profileSection_, __LINE__) = Profiler::Get().RegisterSection(name); \
+    ScopedTimer PROFILE_CONCAT(profileTimer_, __LINE__)(PROFILE_CONCAT(profileSection_, __LINE__), name)
+#else
+#define PROFILE_SCOPE(name) do {} while (0)
+#endif
+
+#endif // PROFILER_H
@@ -0,0 +1,45 @@
+//Rng.cpp
+
+#include "Rng.h"
+
+Rng::Rng(std::uint64_t seed, std::uint64_t stream) {
+    Seed(seed, stream);
+}
+
+void Rng::Seed(std::uint64_t seed, std::uint64_t stream) {
+    state = 0;
+    increment = (stream << 1) | 1;
+    Next();
+    state += seed;
+    Next();
+}
+
+std::uint32_t Rng::Next() {
+    std::uint64_t old = state;
+    state = old * 6364136223846793005ULL + increment;
+    std::uint32_t xorShifted = (std::uint32_t)(((old >> 18) ^ old) >> 27);
+    std::uint32_t rotation = (std::uint32_t)(old >> 59);
+    return (xorShifted >> rotation) | (xorShifted << ((32 - rotation) & 31));
+}
+
+// Lemire's multiply-and-reject: no modulo bias and usually no division.
+int Rng::NextInt(int bound) {
+    if (bound <= 0) {
+        return 0;
+    }
+    std::uint32_t range = (std::uint32_t)bound;
+    std::uint64_t product = (std::uint64_t)Next() * range;
+    std::uint32_t low = (std::uint32_t)product;
+    if (low < range) {
+        std::uint32_t threshold = (0u - range) % range;
+        while (low < threshold) {
+            product = (std::uint64_t)Next() * range;
+            low = (std::uint32_t)product;
+        }
+    }
+    return (int)(product >> 32);
+}
+
+float Rng::NextFloat() {
+    return (Next() >> 8) * (1.0f / 16777216.0f);
+}
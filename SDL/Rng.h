@@ -0,0 +1,25 @@
+// Rng.h
+#ifndef RNG_H
+#define RNG_H
+
+#include <cstdint>
+
+// PCG32 generator (XSH-RR output over a 64-bit LCG). The same seed and stream
+// always give the same sequence, and different streams of one seed are
+// independent. Each owner keeps its own state, so there is no global lock
+// and no hidden coupling between map generation and spawning.
+class Rng {
+    public:
+        Rng(std::uint64_t seed = 0, std::uint64_t stream = 0);
+
+        void Seed(std::uint64_t seed, std::uint64_t stream);
+        std::uint32_t Next();
+        int NextInt(int bound); // uniform in [0, bound), 0 when bound <= 0
+        float NextFloat();      // uniform in [0, 1)
+
+    private:
+        std::uint64_t state;
+        std::uint64_t increment; // odd, picks the stream
+};
+
+#endif // RNG_H
@@ -3,17 +3,84 @@
 #include "Game.h"
 #include "Enemy.h"
 #include "Entity.h"
+#include "Profiler.h"
+#include "AllocTracker.h"
+#include "Tracer.h"
+#ifdef FPS_TRACK_ALLOCATIONS
+#include "SdlAllocHooks.h"
+#endif
 #include <SDL2/SDL.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 
 int main(int argc, char* argv[]) {
+    // before the sim and job threads exist, so whichever records first this track stays ours
+    Tracer::Get().SetThreadName("main");
+#ifdef FPS_TRACK_ALLOCATIONS
+    if (!InstallSdlAllocHooks()) {
+        printf("Could not hook SDL's allocator; only C++ allocations are counted\n");
+    }
+#endif
     Game game;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--tick-rate") == 0 && i + 1 < argc) {
+            game.SetTickRate((float)std::atof(argv[++i]));
+        } else if (std::strcmp(argv[i], "--fps-cap") == 0 && i + 1 < argc) {
+            game.SetFrameRateCap(std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--map-size") == 0 && i + 1 < argc) {
+            int size = std::atoi(argv[++i]);
+            game.SetMapSize(size, size);
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            game.SetSeed(std::strtoull(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            game.SetThreadCount(std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--no-sim-thread") == 0) {
+            game.SetSimThread(false);
+        } else if (std::strcmp(argv[i], "--vsync") == 0) {
+            game.SetVSync(true);
+        } else if (std::strcmp(argv[i], "--no-map-cache") == 0) {
+            game.SetMapCaching(false);
+        } else if (std::strcmp(argv[i], "--render-stats") == 0) {
+            game.SetShowRenderStats(true);
+        } else if (std::strcmp(argv[i], "--asset-timings") == 0) {
+            game.SetShowAssetTimings(true);
+        } else if (std::strcmp(argv[i], "--no-asset-pack") == 0) {
+            game.SetUseAssetPack(false);
+        } else if (std::strcmp(argv[i], "--profile-csv") == 0 && i + 1 < argc) {
+            game.SetProfileCsvPath(argv[++i]);
+        } else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            game.SetRecordPath(argv[++i]);
+        } else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            if (!game.SetReplayPath(argv[++i])) {
+                return 1;
+            }
+        } else if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            game.SetTracePath(argv[++i]);
+        }
+    }
+    // FPS_TRACE=1 traces to trace.json, any other value is the output path
+    const char* traceEnv = std::getenv("FPS_TRACE");
+    if (traceEnv && *traceEnv && !Tracer::Get().IsActive()) {
+        game.SetTracePath(std::strcmp(traceEnv, "1") == 0 ? "trace.json" : traceEnv);
+    }
+
     if (game.Init()) {
         while (game.IsRunning()) {
-            game.HandleEvents();
-            game.Update();
-            game.Render();
+            {
+                PROFILE_SCOPE("Frame");
+                game.HandleEvents();
+                game.Update();
+                game.Render();
+            }
+            Profiler::Get().EndFrame();
+            AllocTracker::Get().EndFrame();
+            {
+                PROFILE_SCOPE("FrameLimit");
+                game.LimitFrameRate();
+            }
         }
     }
     game.Clean();
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,61 @@
+// SdlAllocHooks.cpp
+
+#include "SdlAllocHooks.h"
+#include "AllocTracker.h"
+#include <SDL2/SDL.h>
+
+namespace {
+SDL_malloc_func baseMalloc = nullptr;
+SDL_calloc_func baseCalloc = nullptr;
+SDL_realloc_func baseRealloc = nullptr;
+SDL_free_func baseFree = nullptr;
+bool installed = false;
+
+void* SDLCALL CountingMalloc(size_t size) {
+    void* pointer = baseMalloc(size);
+    if (pointer) {
+        AllocTracker::Get().RecordAllocation(AllocTracker::SDL_MALLOC, size);
+    }
+    return pointer;
+}
+
+void* SDLCALL CountingCalloc(size_t count, size_t size) {
+    void* pointer = baseCalloc(count, size);
+    if (pointer) {
+        AllocTracker::Get().RecordAllocation(AllocTracker::SDL_MALLOC, count * size);
+    }
+    return pointer;
+}
+
+void* SDLCALL CountingRealloc(void* old, size_t size) {
+    void* pointer = baseRealloc(old, size);
+    if (pointer) {
+        // growing in place or moving both count as a trip to the heap
+        AllocTracker::Get().RecordAllocation(AllocTracker::SDL_MALLOC, size);
+        if (old) {
+            AllocTracker::Get().RecordFree(AllocTracker::SDL_MALLOC);
+        }
+    }
+    return pointer;
+}
+
+void SDLCALL CountingFree(void* pointer) {
+    if (pointer) {
+        AllocTracker::Get().RecordFree(AllocTracker::SDL_MALLOC);
+    }
+    baseFree(pointer);
+}
+}
+
+bool InstallSdlAllocHooks() {
+    if (installed) {
+        return true;
+    }
+    SDL_GetMemoryFunctions(&baseMalloc, &baseCalloc, &baseRealloc, &baseFree);
+    if (SDL_SetMemoryFunctions(CountingMalloc, CountingCalloc, CountingRealloc, CountingFree) != 0) {
+        return false;
+    }
+    installed = true;
+    AllocTracker::Get().SetInstalled(AllocTracker::SDL_MALLOC);
+    return true;
+}
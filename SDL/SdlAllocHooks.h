@@ -0,0 +1,10 @@
+// SdlAllocHooks.h
+#ifndef SDL_ALLOC_HOOKS_H
+#define SDL_ALLOC_HOOKS_H
+
+// Routes SDL_malloc, SDL_calloc, SDL_realloc and SDL_free through wrappers
+// that count into AllocTracker, then on to SDL's own functions. Call before
+// SDL_Init, while nothing SDL allocated is still alive. False if SDL refused.
+bool InstallSdlAllocHooks();
+
+#endif // SDL_ALLOC_HOOKS_H
@@ -0,0 +1,267 @@
+// SimRunner.cpp
+
+#include "SimRunner.h"
+#include "Profiler.h"
+#include <cmath>
+
+SimRunner::SimRunner(World& world) : world(world) {
+    stepSize = timestep.GetStepSize();
+    recordLog = nullptr;
+    active = false;
+    stopping = false;
+    ended = false;
+    tick = 0;
+    shotCount = 0;
+    lastShotDirX = 1.0f;
+    lastShotDirY = 0.0f;
+    tileSerial = 0;
+    tileAcknowledged = 0;
+}
+
+SimRunner::~SimRunner() {
+    StopThread();
+}
+
+// ====== Setup ======
+
+void SimRunner::SetTickRate(float ticksPerSecond) {
+    std::lock_guard<std::mutex> lock(stepMutex);
+    timestep.SetTickRate(ticksPerSecond);
+    stepSize = timestep.GetStepSize();
+}
+
+void SimRunner::SetStepSize(float newStepSize) {
+    if (newStepSize <= 0.0f) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(stepMutex);
+    timestep.SetTickRate(1.0f / newStepSize);
+    stepSize = newStepSize;
+}
+
+float SimRunner::GetStepSize() const {
+    return stepSize;
+}
+
+void SimRunner::SetInputSource(InputSource source) {
+    std::lock_guard<std::mutex> lock(stepMutex);
+    inputSource = std::move(source);
+}
+
+void SimRunner::SetRecordLog(InputLog* log) {
+    std::lock_guard<std::mutex> lock(stepMutex);
+    recordLog = log;
+}
+
+void SimRunner::StartThread() {
+    if (thread.joinable()) {
+        return;
+    }
+    stopping = false;
+    thread = std::thread(&SimRunner::ThreadLoop, this);
+}
+
+void SimRunner::StopThread() {
+    {
+        std::lock_guard<std::mutex> lock(stepMutex);
+        stopping = true;
+        active = false;
+    }
+    wake.notify_all();
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+bool SimRunner::IsThreaded() const {
+    return thread.joinable();
+}
+
+// ====== Control ======
+
+void SimRunner::Resume() {
+    {
+        std::lock_guard<std::mutex> lock(stepMutex);
+        RefreshLocked();
+        timestep.Reset();
+        ended = false;
+        active = true;
+        lastAdvance = Clock::now();
+    }
+    wake.notify_all();
+}
+
+void SimRunner::Pause() {
+    {
+        std::lock_guard<std::mutex> lock(stepMutex);
+        active = false;
+        ended = false;
+    }
+    wake.notify_all();
+}
+
+void SimRunner::Refresh() {
+    std::lock_guard<std::mutex> lock(stepMutex);
+    RefreshLocked();
+}
+
+bool SimRunner::IsActive() const {
+    return active.load(std::memory_order_acquire);
+}
+
+bool SimRunner::HasEnded() const {
+    return ended.load(std::memory_order_acquire);
+}
+
+void SimRunner::Advance(float deltaTime) {
+    if (IsThreaded()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(stepMutex);
+    if (active) {
+        AdvanceLocked(deltaTime);
+    }
+}
+
+void SimRunner::SetLiveInput(const InputFrame& input) {
+    std::lock_guard<std::mutex> lock(inputMutex);
+    bool reload = liveInput.reloadPressed || input.reloadPressed;
+    int slot = input.selectWeaponSlot >= 0 ? input.selectWeaponSlot : liveInput.selectWeaponSlot;
+    liveInput = input;
+    liveInput.reloadPressed = reload;
+    liveInput.selectWeaponSlot = slot;
+}
+
+// ====== Reader ======
+
+const FrameSnapshot& SimRunner::AcquireSnapshot() {
+    return snapshots.Acquire();
+}
+
+void SimRunner::AcknowledgeTileEdits(std::uint64_t serial) {
+    tileAcknowledged.store(serial, std::memory_order_release);
+}
+
+// ====== Ticking ======
+
+void SimRunner::ThreadLoop() {
+    Tracer::Get().SetThreadName("sim");
+    std::unique_lock<std::mutex> lock(stepMutex);
+    while (true) {
+        wake.wait(lock, [this]() { return stopping || active; });
+        if (stopping) {
+            return;
+        }
+        Clock::time_point now = Clock::now();
+        float deltaTime = std::chrono::duration<float>(now - lastAdvance).count();
+        lastAdvance = now;
+        AdvanceLocked(deltaTime);
+
+        // sleep until the next tick is due; Pause and StopThread cut it short
+        float untilNextStep = stepSize * (1.0f - timestep.GetAlpha());
+        Clock::time_point due = now + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(untilNextStep));
+        wake.wait_until(lock, due, [this]() { return stopping || !active; });
+    }
+}
+
+void SimRunner::AdvanceLocked(float deltaTime) {
+    World::Status status = World::RUNNING;
+    bool inputEnded = false;
+    timestep.Accumulate(deltaTime);
+    while (timestep.ConsumeStep()) {
+        InputFrame input;
+        if (inputSource) {
+            if (!inputSource(input)) {
+                inputEnded = true;
+                break;
+            }
+        } else {
+            TakeLiveInput(input);
+        }
+        if (recordLog) {
+            recordLog->AddTick(input);
+        }
+        LogTileChanges(); // anything changed between ticks, before Step starts the list over
+        status = world.Step(stepSize, input);
+        tick++;
+        lastInput = input;
+        if (world.FiredThisStep()) {
+            const Entity& player = world.GetPlayer();
+            float aimDx = input.aimX - (player.x + player.width * 0.5f);
+            float aimDy = input.aimY - (player.y + player.height * 0.5f);
+            float aimLen = std::sqrt(aimDx * aimDx + aimDy * aimDy);
+            if (aimLen > 0.0f) {
+                lastShotDirX = aimDx / aimLen;
+                lastShotDirY = aimDy / aimLen;
+            }
+            shotCount++;
+        }
+        LogTileChanges();
+        if (status != World::RUNNING) {
+            break;
+        }
+    }
+
+    bool runEnded = inputEnded || status != World::RUNNING;
+    if (runEnded) {
+        timestep.Reset();
+    }
+    PublishLocked(runEnded ? 1.0f : timestep.GetAlpha(), status, inputEnded);
+    if (runEnded) {
+        // after the publish, so whoever sees ended also gets the final snapshot;
+        // and ended before !active, so no reader ever sees the runner idle but
+        // not ended and resumes the finished world
+        ended.store(true, std::memory_order_release);
+        active.store(false, std::memory_order_release);
+    }
+}
+
+void SimRunner::RefreshLocked() {
+    // the reader resyncs its copy of the map from the world while parked
+    tileLog.clear();
+    world.ClearTileChanges();
+    PublishLocked(1.0f, World::RUNNING, false);
+}
+
+void SimRunner::TakeLiveInput(InputFrame& input) {
+    std::lock_guard<std::mutex> lock(inputMutex);
+    input = liveInput;
+    liveInput.reloadPressed = false;
+    liveInput.selectWeaponSlot = -1;
+}
+
+void SimRunner::LogTileChanges() {
+    const TileMap& map = world.GetTileMap();
+    for (const World::TileChange& change : world.GetTileChanges()) {
+        tileSerial++;
+        tileLog.push_back(FrameSnapshot::TileEdit{change.x, change.y, map.GetType(change.x, change.y),
+                                                  map.GetHP(change.x, change.y), tileSerial});
+    }
+    world.ClearTileChanges(); // so the call before the next Step doesn't log them twice
+}
+
+void SimRunner::PublishLocked(float alpha, World::Status status, bool inputEnded) {
+    PROFILE_SCOPE("Sim.Publish");
+    std::uint64_t acknowledged = tileAcknowledged.load(std::memory_order_acquire);
+    size_t applied = 0;
+    while (applied < tileLog.size() && tileLog[applied].serial <= acknowledged) {
+        applied++;
+    }
+    tileLog.erase(tileLog.begin(), tileLog.begin() + applied);
+
+    FrameSnapshot& snapshot = snapshots.Back();
+    snapshot.CaptureWorld(world);
+    snapshot.status = status;
+    snapshot.inputEnded = inputEnded;
+    snapshot.tick = tick;
+    snapshot.stepSize = stepSize;
+    snapshot.alpha = alpha;
+    snapshot.publishTime = Clock::now();
+    snapshot.lastInput = lastInput;
+    snapshot.shotCount = shotCount;
+    snapshot.lastShotDirX = lastShotDirX;
+    snapshot.lastShotDirY = lastShotDirY;
+    snapshot.tileEdits.reserve(tileLog.capacity());
+    snapshot.tileEdits = tileLog;
+    snapshots.Publish();
+}
@@ -0,0 +1,104 @@
+// SimRunner.h
+#ifndef SIM_RUNNER_H
+#define SIM_RUNNER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "World.h"
+#include "InputFrame.h"
+#include "InputLog.h"
+#include "FixedTimestep.h"
+#include "FrameSnapshot.h"
+#include "TripleBuffer.h"
+
+// Steps a World at a fixed tick rate and publishes a FrameSnapshot after
+// every batch of ticks, so the front end can draw without touching the World.
+// With StartThread the ticks run on their own thread, paced by the clock;
+// otherwise Advance runs them on the caller's thread.
+//
+// The runner is either active (it owns the World) or parked (the caller
+// does). It parks itself when a tick ends the level or the input source
+// runs dry, and reports that through HasEnded. Only touch the World while
+// parked: Pause blocks until any tick in flight has finished.
+class SimRunner {
+    public:
+        // fills input for the next tick; false ends the run without ticking
+        using InputSource = std::function<bool(InputFrame& input)>;
+
+        explicit SimRunner(World& world);
+        ~SimRunner();
+        SimRunner(const SimRunner&) = delete;
+        SimRunner& operator=(const SimRunner&) = delete;
+
+        // ====== Setup (while parked) ======
+        void SetTickRate(float ticksPerSecond);
+        void SetStepSize(float stepSize); // an exact step, e.g. a replay's, used as is for World::Step
+        float GetStepSize() const;
+        void SetInputSource(InputSource source); // empty reads the live input
+        void SetRecordLog(InputLog* log);        // every tick's input is added here; null stops
+        void StartThread();
+        void StopThread(); // parks and joins
+        bool IsThreaded() const;
+
+        // ====== Control ======
+        void Resume();  // publishes the world as it is, then starts ticking from now
+        void Pause();   // parks; returns once no tick is running
+        void Refresh(); // publishes the world as it is without ticking; while parked
+        bool IsActive() const;
+        bool HasEnded() const; // parked by the world or the input source, set before IsActive drops; cleared by Pause and Resume
+        void Advance(float deltaTime); // inline mode: runs the ticks deltaTime covers and publishes
+
+        // Live input for ticks that have no input source; any thread. Reload and
+        // weapon select are held until a tick takes them, so taps aren't lost
+        // between ticks or repeated by several.
+        void SetLiveInput(const InputFrame& input);
+
+        // ====== Reader ======
+        const FrameSnapshot& AcquireSnapshot(); // newest published; stays valid until the next call
+        void AcknowledgeTileEdits(std::uint64_t serial); // edits up to serial are applied and can be dropped
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        World& world;
+        FixedTimestep timestep;
+        float stepSize;
+        InputSource inputSource;
+        InputLog* recordLog;
+
+        std::thread thread;
+        std::mutex stepMutex; // held while ticking, and for every change to the fields below
+        std::condition_variable wake;
+        std::atomic<bool> active; // written under stepMutex, read anywhere
+        bool stopping;
+        Clock::time_point lastAdvance; // thread mode: when the last batch started
+        std::atomic<bool> ended;
+
+        std::mutex inputMutex;
+        InputFrame liveInput;
+
+        TripleBuffer<FrameSnapshot> snapshots;
+        std::uint64_t tick;
+        int shotCount;
+        float lastShotDirX;
+        float lastShotDirY;
+        InputFrame lastInput;
+        std::vector<FrameSnapshot::TileEdit> tileLog; // edits not yet acknowledged, oldest first
+        std::uint64_t tileSerial;
+        std::atomic<std::uint64_t> tileAcknowledged;
+
+        void ThreadLoop();
+        void AdvanceLocked(float deltaTime);
+        void RefreshLocked();
+        void TakeLiveInput(InputFrame& input);
+        void LogTileChanges();
+        void PublishLocked(float alpha, World::Status status, bool inputEnded);
+};
+
+#endif // SIM_RUNNER_H
@@ -0,0 +1,132 @@
+// SpatialHash.cpp
+
+#include "SpatialHash.h"
+#include <cmath>
+
+SpatialHash::SpatialHash(float cellSize)
+    : cellSize(cellSize), inverseCellSize(1.0f / cellSize), bucketMask(0), built(false), scratch(nullptr), currentStamp(0) {
+}
+
+void SpatialHash::Clear() {
+    items.clear();
+    bucketItems.clear();
+    bucketStart.assign(1, 0);
+    bucketMask = 0;
+    built = false;
+}
+
+void SpatialHash::SetScratchArena(Arena* arena) {
+    scratch = arena;
+}
+
+void SpatialHash::Insert(int id, const Entity& bounds) {
+    Item item;
+    item.id = id;
+    item.minCellX = CellCoord(bounds.x);
+    item.minCellY = CellCoord(bounds.y);
+    item.maxCellX = CellCoord(bounds.x + bounds.width);
+    item.maxCellY = CellCoord(bounds.y + bounds.height);
+    items.push_back(item);
+    built = false;
+}
+
+void SpatialHash::Build() {
+    // Two buckets per item keeps chains short without a huge table
+    uint32_t bucketCount = 1;
+    while (bucketCount < items.size() * 2) {
+        bucketCount <<= 1;
+    }
+    bucketMask = bucketCount - 1;
+
+    // Counting sort of (bucket, item) pairs into one flat array
+    bucketStart.assign(bucketCount + 1, 0);
+    for (const Item& item : items) {
+        for (int cy = item.minCellY; cy <= item.maxCellY; cy++) {
+            for (int cx = item.minCellX; cx <= item.maxCellX; cx++) {
+                bucketStart[BucketFor(cx, cy) + 1]++;
+            }
+        }
+    }
+    for (uint32_t b = 0; b < bucketCount; b++) {
+        bucketStart[b + 1] += bucketStart[b];
+    }
+
+    bucketItems.resize(bucketStart[bucketCount]);
+    ArenaVector<int> fill(bucketStart.begin(), bucketStart.end() - 1, ArenaAllocator<int>(scratch));
+    for (int i = 0; i < (int)items.size(); i++) {
+        const Item& item = items[i];
+        for (int cy = item.minCellY; cy <= item.maxCellY; cy++) {
+            for (int cx = item.minCellX; cx <= item.maxCellX; cx++) {
+                bucketItems[fill[BucketFor(cx, cy)]++] = i;
+            }
+        }
+    }
+
+    visitStamp.assign(items.size(), 0);
+    currentStamp = 0;
+    built = true;
+}
+
+void SpatialHash::Query(const Entity& area, std::vector<int>& out) const {
+    QueryInto(area, out);
+}
+
+void SpatialHash::Query(const Entity& area, ArenaVector<int>& out) const {
+    QueryInto(area, out);
+}
+
+template <typename Out>
+void SpatialHash::QueryInto(const Entity& area, Out& out) const {
+    if (!built || items.empty()) {
+        return;
+    }
+    currentStamp++;
+    if (currentStamp == 0) {
+        // stamp wrapped, forget every old visit
+        visitStamp.assign(items.size(), 0);
+        currentStamp = 1;
+    }
+
+    int minCellX = CellCoord(area.x);
+    int minCellY = CellCoord(area.y);
+    int maxCellX = CellCoord(area.x + area.width);
+    int maxCellY = CellCoord(area.y + area.height);
+    for (int cy = minCellY; cy <= maxCellY; cy++) {
+        for (int cx = minCellX; cx <= maxCellX; cx++) {
+            uint32_t bucket = BucketFor(cx, cy);
+            for (int k = bucketStart[bucket]; k < bucketStart[bucket + 1]; k++) {
+                int index = bucketItems[k];
+                const Item& item = items[index];
+                // buckets are shared between cells that hash together, so recheck the range
+                if (visitStamp[index] == currentStamp ||
+                    cx < item.minCellX || cx > item.maxCellX ||
+                    cy < item.minCellY || cy > item.maxCellY) {
+                    continue;
+                }
+                visitStamp[index] = currentStamp;
+                out.push_back(item.id);
+            }
+        }
+    }
+}
+
+float SpatialHash::GetCellSize() const {
+    return cellSize;
+}
+
+int SpatialHash::GetItemCount() const {
+    return (int)items.size();
+}
+
+Arena* SpatialHash::GetScratchArena() const {
+    return scratch;
+}
+
+int SpatialHash::CellCoord(float worldCoord) const {
+    return (int)std::floor(worldCoord * inverseCellSize);
+}
+
+uint32_t SpatialHash::BucketFor(int cellX, int cellY) const {
+    uint32_t h = (uint32_t)cellX * 73856093u ^ (uint32_t)cellY * 19349663u;
+    return h & bucketMask;
+}
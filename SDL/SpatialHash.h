@@ -0,0 +1,55 @@
+// SpatialHash.h
+#ifndef SPATIAL_HASH_H
+#define SPATIAL_HASH_H
+
+#include <cstdint>
+#include <vector>
+#include "Config.h"
+#include "Entity.h"
+#include "Arena.h"
+
+// Uniform grid over world space, rebuilt from scratch each tick.
+// Items are stored by index so callers keep ownership of the real objects.
+// Cells are hashed into a flat bucket table, so the world size is unbounded.
+class SpatialHash {
+    public:
+        explicit SpatialHash(float cellSize = (float)TILE_SIZE);
+
+        void Clear();
+        void Insert(int id, const Entity& bounds);
+        void Build(); // call after the last Insert, before querying
+        void SetScratchArena(Arena* arena); // Build's temporary buffer comes from here; null uses the heap
+
+        // Appends every id whose cell range overlaps area, each id at most once.
+        // Results are candidates only; callers still do their exact overlap test.
+        void Query(const Entity& area, std::vector<int>& out) const;
+        void Query(const Entity& area, ArenaVector<int>& out) const;
+
+        float GetCellSize() const;
+        int GetItemCount() const;
+        Arena* GetScratchArena() const; // for query buffers that only live until the next Build
+
+    private:
+        struct Item {
+            int id;
+            int minCellX, minCellY, maxCellX, maxCellY;
+        };
+
+        float cellSize;
+        float inverseCellSize;
+        std::vector<Item> items;
+        std::vector<int> bucketStart; // bucketStart[b]..bucketStart[b + 1] indexes bucketItems
+        std::vector<int> bucketItems; // indices into items
+        uint32_t bucketMask;
+        bool built;
+        Arena* scratch;
+        mutable std::vector<uint32_t> visitStamp; // per item, dedups multi-cell items within one query
+        mutable uint32_t currentStamp;
+
+        int CellCoord(float worldCoord) const;
+        uint32_t BucketFor(int cellX, int cellY) const;
+        template <typename Out>
+        void QueryInto(const Entity& area, Out& out) const;
+};
+
+#endif // SPATIAL_HASH_H
@@ -1,166 +1,46 @@
 #include "SpawnSystem.h"
 
-#include <cmath>
-#include <cstdlib>
-#include "Config.h"
-
 namespace SpawnSystem {
 
-template<typename ItemT>
-static void SpawnItems(
-    int count,
-    std::vector<ItemT>& items,
+// Entities are at most a tile wide, so one placed on a free tile's corner
+// never overlaps a wall.
+void PlaceEntities(
+    const std::vector<PlacementRequest>& requests,
     const Entity& player,
-    int mapWidth,
-    int mapHeight,
+    FreeTileIndex& freeTiles,
     int tileSize,
-    const std::function<bool(const Entity&, float, float)>& collisionFunc,
-    float itemSizeScale = 0.5f
+    Rng& rng,
+    std::vector<Placement>& placements
 ) {
-    const float MIN_DISTANCE = 100.0f;
-
-    for (int i = 0; i < count; i++) {
-        float spawnX, spawnY;
-        bool collidesWithWall;
-        float distance;
-
-        do {
-            spawnX = rand() % (mapWidth * tileSize);
-            spawnY = rand() % (mapHeight * tileSize);
-
-            Entity temp;
-            temp.x = spawnX;
-            temp.y = spawnY;
-            temp.width = PLAYER_SIZE;
-            temp.height = PLAYER_SIZE;
-
-            collidesWithWall = collisionFunc(temp, spawnX, spawnY);
-
-            float dx = spawnX - player.x;
-            float dy = spawnY - player.y;
-            distance = std::sqrt(dx * dx + dy * dy);
-        } while (collidesWithWall || distance < MIN_DISTANCE);
-
-        ItemT item;
-        item.x = spawnX;
-        item.y = spawnY;
-        item.width = PLAYER_SIZE * itemSizeScale;
-        item.height = PLAYER_SIZE * itemSizeScale;
-        items.push_back(item);
+    size_t total = 0;
+    for (const PlacementRequest& request : requests) {
+        total += request.count > 0 ? request.count : 0;
     }
-}
-
-void SpawnEnemies(
-    int count,
-    std::vector<Enemy>& enemies,
-    const Entity& player,
-    int currentLevel,
-    int mapWidth,
-    int mapHeight,
-    int tileSize,
-    const std::function<bool(const Entity&, float, float)>& collisionFunc,
-    float difficultyMultiplier
-) {
-    const float MIN_DISTANCE = 200.0f;
-    for(int i = 0; i < count; i++) {
-        float spawnX, spawnY;
-        bool collidesWithWall;
-        float distance;
-        do {
-            spawnX = rand() % (mapWidth * tileSize);
-            spawnY = rand() % (mapHeight * tileSize);
-            // Check wall collision
-            Entity temp; // create a temporary entity for collision checking
-            temp.x = spawnX;
-            temp.y = spawnY;
-            temp.width = PLAYER_SIZE;
-            temp.height = PLAYER_SIZE;
-            collidesWithWall = collisionFunc(temp, spawnX, spawnY);
-            // Check distance from player
-            float dx = spawnX - player.x;
-            float dy = spawnY - player.y;
-            distance = std::sqrt(dx*dx + dy*dy);
-        } while(collidesWithWall || distance < MIN_DISTANCE); // ensure enemies don't spawn too close to the player or inside walls
-        Enemy::EnemyType type =
-            static_cast<Enemy::EnemyType>(rand() % 3);
-        enemies.push_back(Enemy(spawnX, spawnY, type, currentLevel, difficultyMultiplier));
+    size_t first = placements.size();
+    placements.reserve(first + total);
+
+    for (const PlacementRequest& request : requests) {
+        for (int i = 0; i < request.count; i++) {
+            int tileX, tileY;
+            if (!freeTiles.Pick(rng, tileSize, player.x, player.y, request.minDistance, tileX, tileY)) {
+                break;
+            }
+            freeTiles.Remove(tileX, tileY);
+            placements.push_back({request.kind, (float)(tileX * tileSize), (float)(tileY * tileSize)});
+        }
     }
-}
-
-void SpawnHealthItems(
-    int count,
-    std::vector<HealthItem>& healthItems,
-    const Entity& player,
-    int mapWidth,
-    int mapHeight,
-    int tileSize,
-    const std::function<bool(const Entity&, float, float)>& collisionFunc
-) {
-    SpawnItems(count, healthItems, player, mapWidth, mapHeight, tileSize, collisionFunc, 1.0f);
-}
 
-void SpawnSpeedItems(
-    int count,
-    std::vector<SpeedItem>& speedItems,
-    const Entity& player,
-    int mapWidth,
-    int mapHeight,
-    int tileSize,
-    const std::function<bool(const Entity&, float, float)>& collisionFunc
-) {
-    SpawnItems(count, speedItems, player, mapWidth, mapHeight, tileSize, collisionFunc, 1.0f);
+    for (size_t i = first; i < placements.size(); i++) {
+        freeTiles.Add((int)placements[i].x / tileSize, (int)placements[i].y / tileSize);
+    }
 }
 
-void SpawnWeaponItems(
-    int count,
-    std::vector<WeaponItem>& weaponItems,
-    const Entity& player,
-    int currentLevel,
-    int mapWidth,
-    int mapHeight,
-    int tileSize,
-    const std::function<bool(const Entity&, float, float)>& collisionFunc
-) {
-    const float MIN_DISTANCE = 100.0f;
-
-    for (int i = 0; i < count; i++) {
-        float spawnX, spawnY;
-        bool collidesWithWall;
-        float distance;
-
-        do {
-            spawnX = rand() % (mapWidth * tileSize);
-            spawnY = rand() % (mapHeight * tileSize);
-
-            Entity temp;
-            temp.x = spawnX;
-            temp.y = spawnY;
-            temp.width = PLAYER_SIZE;
-            temp.height = PLAYER_SIZE;
-
-            collidesWithWall = collisionFunc(temp, spawnX, spawnY);
-
-            float dx = spawnX - player.x;
-            float dy = spawnY - player.y;
-            distance = std::sqrt(dx*dx + dy*dy);
-
-        } while(collidesWithWall || distance < MIN_DISTANCE);
-
-        WeaponItem item;
-        item.x = spawnX;
-        item.y = spawnY;
-        item.width = PLAYER_SIZE;
-        item.height = PLAYER_SIZE;
-    
-        if (currentLevel == 2) {
-            item.type = Weapon::RIFLE;
-        } else if (currentLevel == 3) {
-            item.type = Weapon::SHOTGUN;
-        } else {
-            item.type = Weapon::MACHINEGUN;
-        }
-
-        weaponItems.push_back(item);
+Weapon::WeaponType WeaponItemForLevel(int level) {
+    if (level == 2) {
+        return Weapon::RIFLE;
+    } else if (level == 3) {
+        return Weapon::SHOTGUN;
     }
+    return Weapon::MACHINEGUN;
+}
 }
-}
\ No newline at end of file
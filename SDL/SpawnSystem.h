@@ -2,55 +2,41 @@
 #define SPAWN_SYSTEM_H
 
 #include <vector>
-#include <functional>
 #include "Entity.h"
-#include "Enemy.h"
 #include "Weapon.h"
-#include "Items.h"
+#include "FreeTileIndex.h"
+#include "Rng.h"
 
+// Places every entity a level starts with in one pass over the free-tile
+// index. Each placement takes its tile out of the index for the rest of the
+// batch, so nothing spawns on top of anything else, and the tiles are put
+// back afterwards. The caller turns the placements into real objects.
 namespace SpawnSystem {
-    void SpawnEnemies(
-        int count,
-        std::vector<Enemy>& enemies,
-        const Entity& player,
-        int currentLevel,
-        int mapWidth,
-        int mapHeight,
-        int tileSize,
-        const std::function<bool(const Entity&, float, float)>& collisionFunc,
-        float difficultyMultiplier
-    );
+    enum EntityKind { ENEMY, HEALTH_ITEM, SPEED_ITEM, WEAPON_ITEM };
 
-    void SpawnHealthItems(
-        int count,
-        std::vector<HealthItem>& healthItems,
-        const Entity& player,
-        int mapWidth,
-        int mapHeight,
-        int tileSize,
-        const std::function<bool(const Entity&, float, float)>& collisionFunc
-    );
+    struct PlacementRequest {
+        EntityKind kind;
+        int count;
+        float minDistance; // from the player's corner, in pixels
+    };
 
-    void SpawnSpeedItems(
-        int count,
-        std::vector<SpeedItem>& speedItems,
-        const Entity& player,
-        int mapWidth,
-        int mapHeight,
-        int tileSize,
-        const std::function<bool(const Entity&, float, float)>& collisionFunc
-    );
+    struct Placement {
+        EntityKind kind;
+        float x, y;
+    };
 
-    void SpawnWeaponItems(
-        int count,
-        std::vector<WeaponItem>& weaponItems,
+    // Appends up to the requested count of each kind, in request order.
+    // A kind comes up short only when no free tile is far enough away.
+    void PlaceEntities(
+        const std::vector<PlacementRequest>& requests,
         const Entity& player,
-        int currentLevel,
-        int mapWidth,
-        int mapHeight,
+        FreeTileIndex& freeTiles,
         int tileSize,
-        const std::function<bool(const Entity&, float, float)>& collisionFunc
+        Rng& rng,
+        std::vector<Placement>& placements
     );
+
+    Weapon::WeaponType WeaponItemForLevel(int level);
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,176 @@
+//SpriteAtlas.cpp
+
+#include <algorithm>
+#include "SpriteAtlas.h"
+
+namespace {
+const char* spritePaths[SPRITE_COUNT] = {
+    "sprites/sprite.png",
+    "sprites/walking-1.png",
+    "sprites/walking-3.png",
+    "sprites/sprite_with_pistol.png",
+    "sprites/sprite_with_shotgun.png",
+    "sprites/sprite_with_smg.png",
+    "sprites/pistol-walking-1.png",
+    "sprites/pistol-walking-3.png",
+    "sprites/shotgun-walking-1.png",
+    "sprites/shotgun-walking-3.png",
+    "sprites/smg-walking-1.png",
+    "sprites/smg-walking-3.png",
+    "sprites/pistol.png",
+    "sprites/shotgun.png",
+    "sprites/smg.png",
+    "sprites/brickwall4.png",
+    "sprites/floor5.png",
+    "sprites/brokenWall.png",
+    "sprites/heart.png",
+    "sprites/speedbooster.png",
+    "sprites/chest.png",
+    "sprites/enemy.png",
+    "sprites/enemy2.png",
+    "sprites/enemy3.png"
+};
+
+const int solidBlockSize = 4; // only the inner texels are sampled, so filtering stays white
+}
+
+SpriteAtlas::SpriteAtlas() {
+    texture = nullptr;
+    width = 0;
+    height = 0;
+    for (SDL_Rect& rect : rects) {
+        rect = {0, 0, 0, 0};
+    }
+    solidRect = {0, 0, 0, 0};
+}
+
+SpriteAtlas::~SpriteAtlas() {
+    Release();
+}
+
+const char* SpriteAtlas::GetPath(SpriteId id) {
+    return spritePaths[id];
+}
+
+int SpriteAtlas::Pack(const std::vector<SDL_Point>& sizes, int maxWidth, int padding, std::vector<SDL_Rect>& placed) {
+    placed.assign(sizes.size(), SDL_Rect{0, 0, 0, 0});
+    std::vector<int> order(sizes.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        order[i] = (int)i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return sizes[a].y > sizes[b].y; });
+
+    int penX = 0;
+    int penY = 0;
+    int rowHeight = 0;
+    for (int index : order) {
+        const SDL_Point& size = sizes[index];
+        if (size.x <= 0 || size.y <= 0) {
+            continue;
+        }
+        if (penX > 0 && penX + size.x > maxWidth) {
+            penX = 0;
+            penY += rowHeight + padding;
+            rowHeight = 0;
+        }
+        placed[index] = {penX, penY, size.x, size.y};
+        penX += size.x + padding;
+        rowHeight = std::max(rowHeight, size.y);
+    }
+    return penY + rowHeight;
+}
+
+bool SpriteAtlas::Load(SDL_Renderer* renderer, AssetManager& assets) {
+    Release();
+
+    // the last slot is the solid block used for plain colored quads
+    std::vector<SDL_Surface*> surfaces(SPRITE_COUNT, nullptr);
+    std::vector<SDL_Point> sizes(SPRITE_COUNT + 1, SDL_Point{0, 0});
+    for (int i = 0; i < SPRITE_COUNT; i++) {
+        surfaces[i] = assets.LoadSurface(spritePaths[i]);
+        if (surfaces[i]) {
+            sizes[i] = {surfaces[i]->w, surfaces[i]->h};
+        }
+    }
+    sizes[SPRITE_COUNT] = {solidBlockSize, solidBlockSize};
+
+    std::vector<SDL_Rect> placed;
+    height = Pack(sizes, maxWidth, padding, placed);
+    width = maxWidth;
+
+    SDL_Surface* atlasSurface = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_RGBA32);
+    if (atlasSurface) {
+        for (int i = 0; i < SPRITE_COUNT; i++) {
+            if (!surfaces[i]) {
+                continue;
+            }
+            SDL_Rect dst = placed[i];
+            SDL_SetSurfaceBlendMode(surfaces[i], SDL_BLENDMODE_NONE);
+            SDL_BlitSurface(surfaces[i], nullptr, atlasSurface, &dst);
+            rects[i] = placed[i];
+        }
+
+        const SDL_Rect& block = placed[SPRITE_COUNT];
+        SDL_LockSurface(atlasSurface);
+        for (int y = block.y; y < block.y + block.h; y++) {
+            Uint32* row = (Uint32*)((Uint8*)atlasSurface->pixels + y * atlasSurface->pitch);
+            for (int x = block.x; x < block.x + block.w; x++) {
+                row[x] = 0xFFFFFFFFu;
+            }
+        }
+        SDL_UnlockSurface(atlasSurface);
+        solidRect = {block.x + 1, block.y + 1, block.w - 2, block.h - 2};
+
+        texture = SDL_CreateTextureFromSurface(renderer, atlasSurface);
+        if (texture) {
+            SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+        }
+        SDL_FreeSurface(atlasSurface);
+    }
+
+    for (SDL_Surface* surface : surfaces) {
+        SDL_FreeSurface(surface);
+    }
+    if (!texture) {
+        Release();
+        return false;
+    }
+    return true;
+}
+
+void SpriteAtlas::Release() {
+    if (texture) {
+        SDL_DestroyTexture(texture);
+        texture = nullptr;
+    }
+    width = 0;
+    height = 0;
+    for (SDL_Rect& rect : rects) {
+        rect = {0, 0, 0, 0};
+    }
+    solidRect = {0, 0, 0, 0};
+}
+
+SDL_Texture* SpriteAtlas::GetTexture() const {
+    return texture;
+}
+
+int SpriteAtlas::GetWidth() const {
+    return width;
+}
+
+int SpriteAtlas::GetHeight() const {
+    return height;
+}
+
+bool SpriteAtlas::Has(SpriteId id) const {
+    return texture && rects[id].w > 0;
+}
+
+const SDL_Rect& SpriteAtlas::GetRect(SpriteId id) const {
+    return rects[id];
+}
+
+const SDL_Rect& SpriteAtlas::GetSolidRect() const {
+    return solidRect;
+}
@@ -0,0 +1,69 @@
+// SpriteAtlas.h
+#ifndef SPRITE_ATLAS_H
+#define SPRITE_ATLAS_H
+
+#include <vector>
+#include <SDL2/SDL.h>
+#include "AssetManager.h"
+
+// Every sprite the game draws, packed into one atlas texture at startup.
+enum SpriteId {
+    SPRITE_PLAYER,
+    SPRITE_PLAYER_WALK_1,
+    SPRITE_PLAYER_WALK_2,
+    SPRITE_PLAYER_PISTOL,
+    SPRITE_PLAYER_SHOTGUN,
+    SPRITE_PLAYER_SMG,
+    SPRITE_PISTOL_WALK_1,
+    SPRITE_PISTOL_WALK_2,
+    SPRITE_SHOTGUN_WALK_1,
+    SPRITE_SHOTGUN_WALK_2,
+    SPRITE_SMG_WALK_1,
+    SPRITE_SMG_WALK_2,
+    SPRITE_ICON_PISTOL,
+    SPRITE_ICON_SHOTGUN,
+    SPRITE_ICON_SMG,
+    SPRITE_WALL,
+    SPRITE_FLOOR,
+    SPRITE_BROKEN_WALL,
+    SPRITE_HEALTH_ITEM,
+    SPRITE_SPEED_ITEM,
+    SPRITE_WEAPON_ITEM,
+    SPRITE_ENEMY_HORIZONTAL,
+    SPRITE_ENEMY_VERTICAL,
+    SPRITE_ENEMY_SMART,
+    SPRITE_COUNT
+};
+
+class SpriteAtlas {
+    public:
+        static constexpr int maxWidth = 256;
+        static constexpr int padding = 1; // transparent gap so neighbours never bleed in
+
+        SpriteAtlas();
+        ~SpriteAtlas();
+
+        static const char* GetPath(SpriteId id);
+        // Shelf-packs the sizes tallest first into rows no wider than maxWidth.
+        // placed[i] is where sizes[i] went; returns the total height used.
+        static int Pack(const std::vector<SDL_Point>& sizes, int maxWidth, int padding, std::vector<SDL_Rect>& placed);
+
+        bool Load(SDL_Renderer* renderer, AssetManager& assets); // missing sprites are skipped, check Has()
+        void Release();
+
+        SDL_Texture* GetTexture() const;
+        int GetWidth() const;
+        int GetHeight() const;
+        bool Has(SpriteId id) const;
+        const SDL_Rect& GetRect(SpriteId id) const;
+        const SDL_Rect& GetSolidRect() const; // opaque white texels, for untextured quads
+
+    private:
+        SDL_Texture* texture;
+        int width;
+        int height;
+        SDL_Rect rects[SPRITE_COUNT];
+        SDL_Rect solidRect;
+};
+
+#endif // SPRITE_ATLAS_H
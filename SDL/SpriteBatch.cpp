@@ -0,0 +1,113 @@
+//SpriteBatch.cpp
+
+#include <algorithm>
+#include "SpriteBatch.h"
+
+SpriteBatch::SpriteBatch() {
+    renderer = nullptr;
+    atlas = nullptr;
+    drawCalls = 0;
+    quadCount = 0;
+}
+
+void SpriteBatch::Begin(SDL_Renderer* renderer, const SpriteAtlas& atlas) {
+    this->renderer = renderer;
+    this->atlas = &atlas;
+    quads.clear();
+}
+
+bool SpriteBatch::AddSprite(SpriteId id, const SDL_Rect& dst, SDL_Color tint, Layer layer, bool flipX) {
+    if (!atlas || !atlas->Has(id)) {
+        return false;
+    }
+    AddQuad(dst, atlas->GetRect(id), tint, layer, flipX);
+    return true;
+}
+
+void SpriteBatch::AddRect(const SDL_Rect& dst, SDL_Color color, Layer layer) {
+    SDL_Rect src = {0, 0, 0, 0};
+    if (atlas) {
+        src = atlas->GetSolidRect();
+    }
+    AddQuad(dst, src, color, layer, false);
+}
+
+void SpriteBatch::AddQuad(const SDL_Rect& dst, const SDL_Rect& src, SDL_Color color, Layer layer, bool flipX) {
+    if (dst.w <= 0 || dst.h <= 0) {
+        return;
+    }
+    Quad quad;
+    quad.x0 = (float)dst.x;
+    quad.y0 = (float)dst.y;
+    quad.x1 = (float)(dst.x + dst.w);
+    quad.y1 = (float)(dst.y + dst.h);
+    quad.u0 = quad.v0 = quad.u1 = quad.v1 = 0.0f;
+    if (atlas && atlas->GetWidth() > 0 && atlas->GetHeight() > 0) {
+        float invWidth = 1.0f / atlas->GetWidth();
+        float invHeight = 1.0f / atlas->GetHeight();
+        quad.u0 = src.x * invWidth;
+        quad.v0 = src.y * invHeight;
+        quad.u1 = (src.x + src.w) * invWidth;
+        quad.v1 = (src.y + src.h) * invHeight;
+    }
+    if (flipX) {
+        std::swap(quad.u0, quad.u1);
+    }
+    quad.color = color;
+    quad.layer = layer;
+    quad.sequence = (int)quads.size();
+    quads.push_back(quad);
+}
+
+void SpriteBatch::Flush() {
+    if (quads.empty() || !renderer) {
+        quads.clear();
+        return;
+    }
+
+    std::sort(quads.begin(), quads.end(), [](const Quad& a, const Quad& b) {
+        if (a.layer != b.layer) {
+            return a.layer < b.layer;
+        }
+        return a.sequence < b.sequence;
+    });
+
+    vertices.clear();
+    indices.clear();
+    for (const Quad& quad : quads) {
+        int base = (int)vertices.size();
+        vertices.push_back({{quad.x0, quad.y0}, quad.color, {quad.u0, quad.v0}});
+        vertices.push_back({{quad.x1, quad.y0}, quad.color, {quad.u1, quad.v0}});
+        vertices.push_back({{quad.x1, quad.y1}, quad.color, {quad.u1, quad.v1}});
+        vertices.push_back({{quad.x0, quad.y1}, quad.color, {quad.u0, quad.v1}});
+        indices.push_back(base);
+        indices.push_back(base + 1);
+        indices.push_back(base + 2);
+        indices.push_back(base);
+        indices.push_back(base + 2);
+        indices.push_back(base + 3);
+    }
+
+    // without an atlas the quads still draw as plain colors
+    SDL_Texture* texture = atlas ? atlas->GetTexture() : nullptr;
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_RenderGeometry(renderer, texture, vertices.data(), (int)vertices.size(), indices.data(), (int)indices.size());
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+
+    drawCalls++;
+    quadCount += (int)quads.size();
+    quads.clear();
+}
+
+int SpriteBatch::GetDrawCalls() const {
+    return drawCalls;
+}
+
+int SpriteBatch::GetQuadCount() const {
+    return quadCount;
+}
+
+void SpriteBatch::ResetStats() {
+    drawCalls = 0;
+    quadCount = 0;
+}
@@ -0,0 +1,48 @@
+// SpriteBatch.h
+#ifndef SPRITE_BATCH_H
+#define SPRITE_BATCH_H
+
+#include <vector>
+#include <SDL2/SDL.h>
+#include "SpriteAtlas.h"
+
+// Collects quads over the sprite atlas and submits them in one SDL_RenderGeometry
+// call. Quads are sorted by layer on Flush, keeping submission order within a
+// layer, so callers can add sprites in whatever order is convenient. Solid color
+// rectangles sample the atlas' white block and land in the same call.
+class SpriteBatch {
+    public:
+        enum Layer { LAYER_GROUND, LAYER_ACTORS, LAYER_EFFECTS, LAYER_OVERLAY };
+
+        SpriteBatch();
+
+        void Begin(SDL_Renderer* renderer, const SpriteAtlas& atlas);
+        bool AddSprite(SpriteId id, const SDL_Rect& dst, SDL_Color tint, Layer layer, bool flipX = false); // false when the sprite didn't load
+        void AddRect(const SDL_Rect& dst, SDL_Color color, Layer layer);
+        void Flush();
+
+        int GetDrawCalls() const; // geometry submissions since ResetStats
+        int GetQuadCount() const;
+        void ResetStats();
+
+    private:
+        struct Quad {
+            float x0, y0, x1, y1;
+            float u0, v0, u1, v1;
+            SDL_Color color;
+            int layer;
+            int sequence;
+        };
+
+        SDL_Renderer* renderer;
+        const SpriteAtlas* atlas;
+        std::vector<Quad> quads;
+        std::vector<SDL_Vertex> vertices; // reused between flushes
+        std::vector<int> indices;
+        int drawCalls;
+        int quadCount;
+
+        void AddQuad(const SDL_Rect& dst, const SDL_Rect& src, SDL_Color color, Layer layer, bool flipX);
+};
+
+#endif // SPRITE_BATCH_H
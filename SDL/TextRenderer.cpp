@@ -0,0 +1,261 @@
+//TextRenderer.cpp
+
+#include <algorithm>
+#include "TextRenderer.h"
+
+TextRenderer::TextRenderer() {
+    renderer = nullptr;
+    assets = nullptr;
+    font = nullptr;
+    atlas = nullptr;
+    atlasHeight = 0;
+    lineHeight = 0;
+    for (int i = 0; i < glyphCount; i++) {
+        glyphRects[i] = {0, 0, 0, 0};
+        advances[i] = 0;
+    }
+}
+
+TextRenderer::~TextRenderer() {
+    Release();
+}
+
+bool TextRenderer::Load(SDL_Renderer* renderer, AssetManager& assets, const char* fontFile, int pointSize) {
+    Release();
+    if (!renderer) {
+        return false;
+    }
+    this->renderer = renderer;
+
+    font = assets.AcquireFont(fontFile, pointSize);
+    if (!font) {
+        return false;
+    }
+    this->assets = &assets;
+
+    if (!BuildAtlas()) {
+        Release();
+        return false;
+    }
+    return true;
+}
+
+void TextRenderer::Release() {
+    for (auto& entry : cache) {
+        SDL_DestroyTexture(entry.second.texture);
+    }
+    cache.clear();
+    if (atlas) {
+        SDL_DestroyTexture(atlas);
+        atlas = nullptr;
+    }
+    if (font) {
+        assets->ReleaseFont(font);
+        font = nullptr;
+        assets = nullptr;
+    }
+    atlasHeight = 0;
+    lineHeight = 0;
+}
+
+bool TextRenderer::IsLoaded() const {
+    return atlas != nullptr;
+}
+
+int TextRenderer::GetLineHeight() const {
+    return lineHeight;
+}
+
+bool TextRenderer::BuildAtlas() {
+    const SDL_Color white = {255, 255, 255, 255};
+    lineHeight = TTF_FontHeight(font);
+
+    // Rasterize every glyph white so Draw can tint with vertex colors
+    std::vector<SDL_Surface*> surfaces(glyphCount, nullptr);
+    for (int i = 0; i < glyphCount; i++) {
+        Uint16 ch = (Uint16)(firstGlyph + i);
+        SDL_Surface* rendered = TTF_RenderGlyph_Solid(font, ch, white);
+        if (rendered) {
+            surfaces[i] = SDL_ConvertSurfaceFormat(rendered, SDL_PIXELFORMAT_RGBA32, 0);
+            SDL_FreeSurface(rendered);
+        }
+        int advance = 0;
+        if (TTF_GlyphMetrics(font, ch, nullptr, nullptr, nullptr, nullptr, &advance) != 0) {
+            advance = surfaces[i] ? surfaces[i]->w : 0;
+        }
+        advances[i] = advance;
+        lineHeight = std::max(lineHeight, surfaces[i] ? surfaces[i]->h : 0);
+    }
+
+    std::vector<SDL_Point> sizes(glyphCount, SDL_Point{0, 0});
+    for (int i = 0; i < glyphCount; i++) {
+        if (surfaces[i]) {
+            sizes[i] = {surfaces[i]->w, surfaces[i]->h};
+        }
+    }
+    std::vector<SDL_Rect> placed;
+    atlasHeight = PackGlyphs(sizes, placed);
+    std::copy(placed.begin(), placed.end(), glyphRects);
+
+    bool built = false;
+    SDL_Surface* atlasSurface = nullptr;
+    if (atlasHeight > 0) {
+        atlasSurface = SDL_CreateRGBSurfaceWithFormat(0, atlasWidth, atlasHeight, 32, SDL_PIXELFORMAT_RGBA32);
+    }
+    if (atlasSurface) {
+        for (int i = 0; i < glyphCount; i++) {
+            if (!surfaces[i]) {
+                continue;
+            }
+            SDL_Rect dst = glyphRects[i];
+            SDL_SetSurfaceBlendMode(surfaces[i], SDL_BLENDMODE_NONE);
+            SDL_BlitSurface(surfaces[i], nullptr, atlasSurface, &dst);
+        }
+        atlas = SDL_CreateTextureFromSurface(renderer, atlasSurface);
+        if (atlas) {
+            SDL_SetTextureBlendMode(atlas, SDL_BLENDMODE_BLEND);
+            built = true;
+        }
+        SDL_FreeSurface(atlasSurface);
+    }
+
+    for (SDL_Surface* surface : surfaces) {
+        SDL_FreeSurface(surface);
+    }
+    return built;
+}
+
+int TextRenderer::GlyphIndex(char c) {
+    int code = (unsigned char)c;
+    if (code < firstGlyph || code > lastGlyph) {
+        code = '?';
+    }
+    return code - firstGlyph;
+}
+
+int TextRenderer::PackGlyphs(const std::vector<SDL_Point>& sizes, std::vector<SDL_Rect>& placed) {
+    placed.assign(sizes.size(), SDL_Rect{0, 0, 0, 0});
+    int penX = 0;
+    int penY = 0;
+    int rowHeight = 0;
+    for (size_t i = 0; i < sizes.size(); i++) {
+        if (sizes[i].x <= 0 || sizes[i].y <= 0) {
+            continue;
+        }
+        if (penX + sizes[i].x > atlasWidth) {
+            penX = 0;
+            penY += rowHeight + 1;
+            rowHeight = 0;
+        }
+        placed[i] = {penX, penY, sizes[i].x, sizes[i].y};
+        penX += sizes[i].x + 1;
+        rowHeight = std::max(rowHeight, sizes[i].y);
+    }
+    return penY + rowHeight;
+}
+
+int TextRenderer::MeasureAdvances(const char* text, const int* advances) {
+    int width = 0;
+    for (const char* c = text; *c; c++) {
+        width += advances[GlyphIndex(*c)];
+    }
+    return width;
+}
+
+void TextRenderer::MeasureText(const char* text, int& width, int& height) const {
+    width = 0;
+    height = IsLoaded() ? lineHeight : 0;
+    if (!IsLoaded()) {
+        return;
+    }
+    width = MeasureAdvances(text, advances);
+}
+
+void TextRenderer::Draw(const char* text, int x, int y, SDL_Color color) {
+    if (!IsLoaded()) {
+        return;
+    }
+
+    vertices.clear();
+    indices.clear();
+    float invWidth = 1.0f / atlasWidth;
+    float invHeight = 1.0f / atlasHeight;
+    int penX = x;
+    for (const char* c = text; *c; c++) {
+        int index = GlyphIndex(*c);
+        const SDL_Rect& src = glyphRects[index];
+        if (src.w > 0) {
+            float left = (float)penX;
+            float top = (float)y;
+            float right = left + src.w;
+            float bottom = top + src.h;
+            float u0 = src.x * invWidth;
+            float v0 = src.y * invHeight;
+            float u1 = (src.x + src.w) * invWidth;
+            float v1 = (src.y + src.h) * invHeight;
+
+            int base = (int)vertices.size();
+            vertices.push_back({{left, top}, color, {u0, v0}});
+            vertices.push_back({{right, top}, color, {u1, v0}});
+            vertices.push_back({{right, bottom}, color, {u1, v1}});
+            vertices.push_back({{left, bottom}, color, {u0, v1}});
+            indices.push_back(base);
+            indices.push_back(base + 1);
+            indices.push_back(base + 2);
+            indices.push_back(base);
+            indices.push_back(base + 2);
+            indices.push_back(base + 3);
+        }
+        penX += advances[index];
+    }
+
+    if (!indices.empty()) {
+        SDL_RenderGeometry(renderer, atlas, vertices.data(), (int)vertices.size(), indices.data(), (int)indices.size());
+    }
+}
+
+const TextRenderer::CachedText* TextRenderer::FindOrCache(const char* text) {
+    auto it = cache.find(std::string_view(text));
+    if (it != cache.end()) {
+        return &it->second;
+    }
+    if (!font || (int)cache.size() >= maxCachedStrings) {
+        return nullptr;
+    }
+
+    const SDL_Color white = {255, 255, 255, 255};
+    SDL_Surface* surface = TTF_RenderText_Solid(font, text, white);
+    if (!surface) {
+        return nullptr;
+    }
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    CachedText cached = {texture, surface->w, surface->h};
+    SDL_FreeSurface(surface);
+    if (!texture) {
+        return nullptr;
+    }
+    return &cache.emplace(text, cached).first->second;
+}
+
+void TextRenderer::MeasureCached(const char* text, int& width, int& height) {
+    const CachedText* cached = FindOrCache(text);
+    if (cached) {
+        width = cached->width;
+        height = cached->height;
+    } else {
+        MeasureText(text, width, height);
+    }
+}
+
+void TextRenderer::DrawCached(const char* text, int x, int y, SDL_Color color) {
+    const CachedText* cached = FindOrCache(text);
+    if (!cached) {
+        // cache full or the string failed to render, lay it out from the atlas instead
+        Draw(text, x, y, color);
+        return;
+    }
+    SDL_SetTextureColorMod(cached->texture, color.r, color.g, color.b);
+    SDL_SetTextureAlphaMod(cached->texture, color.a);
+    SDL_Rect dst = {x, y, cached->width, cached->height};
+    SDL_RenderCopy(renderer, cached->texture, nullptr, &dst);
+}
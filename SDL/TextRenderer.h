@@ -0,0 +1,77 @@
+// TextRenderer.h
+#ifndef TEXT_RENDERER_H
+#define TEXT_RENDERER_H
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include "AssetManager.h"
+
+// One font at one size, rasterized into a glyph atlas when loaded. Draw lays a
+// string out as quads over the atlas and submits them in a single
+// SDL_RenderGeometry call, so changing HUD text costs no surfaces or uploads.
+// Strings that never change (labels, prompts) can go through DrawCached, which
+// renders them to a texture once and reuses it; the lookup takes the caller's
+// characters as they are, so a cached label costs no allocation per frame.
+class TextRenderer {
+    public:
+        static constexpr int firstGlyph = 32; // printable ASCII; anything else draws as '?'
+        static constexpr int lastGlyph = 126;
+        static constexpr int glyphCount = lastGlyph - firstGlyph + 1;
+        static constexpr int maxCachedStrings = 64;
+        static constexpr int atlasWidth = 512;
+
+        TextRenderer();
+        ~TextRenderer();
+
+        bool Load(SDL_Renderer* renderer, AssetManager& assets, const char* fontFile, int pointSize);
+        void Release();
+        bool IsLoaded() const;
+        int GetLineHeight() const;
+
+        void MeasureText(const char* text, int& width, int& height) const;
+        void Draw(const char* text, int x, int y, SDL_Color color);
+
+        void MeasureCached(const char* text, int& width, int& height);
+        void DrawCached(const char* text, int x, int y, SDL_Color color);
+
+        // Atlas slot for c: printable ASCII, anything else is '?'
+        static int GlyphIndex(char c);
+        // Shelf-packs glyph sizes left to right in rows of atlasWidth with a
+        // 1px gap; empty sizes get an empty rect. Returns the atlas height.
+        static int PackGlyphs(const std::vector<SDL_Point>& sizes, std::vector<SDL_Rect>& placed);
+        // Sum of the advances (indexed by GlyphIndex) along text
+        static int MeasureAdvances(const char* text, const int* advances);
+
+    private:
+        struct CachedText {
+            SDL_Texture* texture;
+            int width, height;
+        };
+        // lets find take a string_view without building a std::string
+        struct TextHash {
+            using is_transparent = void;
+            size_t operator()(std::string_view text) const { return std::hash<std::string_view>()(text); }
+        };
+
+        SDL_Renderer* renderer;
+        AssetManager* assets; // the font goes back here on Release
+        TTF_Font* font;
+        SDL_Texture* atlas;
+        int atlasHeight;
+        int lineHeight;
+        SDL_Rect glyphRects[glyphCount]; // in the atlas
+        int advances[glyphCount];
+        std::vector<SDL_Vertex> vertices; // reused between draws
+        std::vector<int> indices;
+        std::unordered_map<std::string, CachedText, TextHash, std::equal_to<>> cache;
+
+        bool BuildAtlas();
+        const CachedText* FindOrCache(const char* text);
+};
+
+#endif // TEXT_RENDERER_H
@@ -0,0 +1,57 @@
+// TileCollisionView.h
+#ifndef TILE_COLLISION_VIEW_H
+#define TILE_COLLISION_VIEW_H
+
+#include <algorithm>
+#include "Entity.h"
+#include "TileMap.h"
+
+// Read-only window onto a tile map, passed by reference into the hot
+// movement/bullet/spawn loops instead of a std::function callback so the
+// tile lookups can be inlined. It does not own the map it points at.
+// A default-constructed view has no tiles and never collides.
+struct TileCollisionView {
+    const TileMap* map = nullptr;
+    int tileSize = 1;
+
+    int GetWidth() const { return map ? map->GetWidth() : 0; }
+    int GetHeight() const { return map ? map->GetHeight() : 0; }
+
+    // out of bounds counts as solid
+    bool IsSolidTile(int x, int y) const {
+        return map && map->IsSolid(x, y);
+    }
+
+    // return true if entity would overlap a solid tile at (nextX, nextY)
+    bool Collides(const Entity& entity, float nextX, float nextY) const {
+        if (!map) {
+            return false;
+        }
+        // Use a smaller inset for tiny entities (like 5x5 bullets)
+        const float minHalfSize = std::min(entity.width, entity.height) * 0.5f;
+        const float collisionInset = std::min(6.0f, std::max(0.0f, minHalfSize - 0.5f));
+        float x = nextX + collisionInset;
+        float y = nextY + collisionInset;
+        float w = entity.width - collisionInset * 2.0f;
+        float h = entity.height - collisionInset * 2.0f;
+
+        if (w < 1.0f) w = 1.0f;
+        if (h < 1.0f) h = 1.0f;
+
+        int leftTile   = (int)(x / tileSize);
+        int rightTile  = (int)((x + w - 1) / tileSize);
+        int topTile    = (int)(y / tileSize);
+        int bottomTile = (int)((y + h - 1) / tileSize);
+
+        for (int tileY = topTile; tileY <= bottomTile; tileY++) {
+            for (int tileX = leftTile; tileX <= rightTile; tileX++) {
+                if (map->IsSolid(tileX, tileY)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+};
+
+#endif // TILE_COLLISION_VIEW_H
@@ -0,0 +1,40 @@
+// TileMap.cpp
+
+#include "TileMap.h"
+#include <algorithm>
+
+TileMap::TileMap() : width(0), height(0), chunksX(0) {
+}
+
+TileMap::TileMap(int width, int height) : TileMap() {
+    Resize(width, height);
+}
+
+void TileMap::Resize(int newWidth, int newHeight) {
+    width = std::max(0, newWidth);
+    height = std::max(0, newHeight);
+    chunksX = (width + chunkMask) >> chunkShift;
+    int chunksY = (height + chunkMask) >> chunkShift;
+    chunks.assign((size_t)chunksX * chunksY, Chunk{});
+}
+
+size_t TileMap::GetMemoryBytes() const {
+    return chunks.size() * sizeof(Chunk);
+}
+
+void TileMap::SetTile(int x, int y, int type, int hp) {
+    if (!InBounds(x, y)) {
+        return;
+    }
+    Chunk& chunk = ChunkAt(x, y);
+    int local = LocalIndex(x, y);
+    chunk.type[local] = (uint8_t)type;
+    chunk.hp[local] = (uint16_t)std::clamp(hp, 0, 0xFFFF);
+}
+
+void TileMap::SetHP(int x, int y, int hp) {
+    if (!InBounds(x, y)) {
+        return;
+    }
+    ChunkAt(x, y).hp[LocalIndex(x, y)] = (uint16_t)std::clamp(hp, 0, 0xFFFF);
+}
@@ -0,0 +1,81 @@
+// TileMap.h
+#ifndef TILE_MAP_H
+#define TILE_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Run-time sized tile grid stored in 32x32 chunks, so neighbouring tiles in
+// both directions share cache lines. Each tile is one byte of type
+// (0 floor, 1 border wall, 2 wall, 3 breakable wall) plus two bytes of HP.
+class TileMap {
+    public:
+        static const int chunkShift = 5;
+        static const int chunkSize = 1 << chunkShift;
+        static const int chunkMask = chunkSize - 1;
+
+        TileMap();
+        TileMap(int width, int height);
+
+        void Resize(int width, int height); // every tile becomes floor
+        int GetWidth() const { return width; }
+        int GetHeight() const { return height; }
+        size_t GetMemoryBytes() const;
+
+        bool InBounds(int x, int y) const {
+            return x >= 0 && x < width && y >= 0 && y < height;
+        }
+
+        // out of bounds reads as border wall
+        int GetType(int x, int y) const {
+            if (!InBounds(x, y)) {
+                return 1;
+            }
+            return ChunkAt(x, y).type[LocalIndex(x, y)];
+        }
+
+        int GetHP(int x, int y) const {
+            if (!InBounds(x, y)) {
+                return 0;
+            }
+            return ChunkAt(x, y).hp[LocalIndex(x, y)];
+        }
+
+        // out of bounds counts as solid
+        bool IsSolid(int x, int y) const {
+            if (!InBounds(x, y)) {
+                return true;
+            }
+            const Chunk& chunk = ChunkAt(x, y);
+            int local = LocalIndex(x, y);
+            uint8_t tile = chunk.type[local];
+            return tile == 1 || tile == 2 || (tile == 3 && chunk.hp[local] > 0);
+        }
+
+        void SetTile(int x, int y, int type, int hp);
+        void SetHP(int x, int y, int hp);
+
+    private:
+        struct Chunk {
+            uint8_t type[chunkSize * chunkSize];
+            uint16_t hp[chunkSize * chunkSize];
+        };
+
+        int width;
+        int height;
+        int chunksX;
+        std::vector<Chunk> chunks;
+
+        const Chunk& ChunkAt(int x, int y) const {
+            return chunks[(y >> chunkShift) * chunksX + (x >> chunkShift)];
+        }
+        Chunk& ChunkAt(int x, int y) {
+            return chunks[(y >> chunkShift) * chunksX + (x >> chunkShift)];
+        }
+        static int LocalIndex(int x, int y) {
+            return ((y & chunkMask) << chunkShift) | (x & chunkMask);
+        }
+};
+
+#endif // TILE_MAP_H
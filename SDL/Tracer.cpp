@@ -0,0 +1,127 @@
+//Tracer.cpp
+
+#include <algorithm>
+#include <cstdio>
+#include "Tracer.h"
+
+namespace {
+thread_local int traceTrack = 0; // 0 until the thread first records or is named
+}
+
+Tracer& Tracer::Get() {
+    static Tracer tracer;
+    return tracer;
+}
+
+void Tracer::Start(int capacity) {
+    std::lock_guard<std::mutex> lock(mutex);
+    events.assign(std::max(capacity, 1), Event());
+    next = 0;
+    count = 0;
+    dropped = 0;
+    origin = std::chrono::steady_clock::now();
+    active = true;
+}
+
+void Tracer::Stop() {
+    active = false;
+}
+
+void Tracer::SetThreadName(const char* name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    threadNames[ThreadTrack() - 1] = name;
+}
+
+void Tracer::AddComplete(const char* name, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) {
+    if (!IsActive()) {
+        return;
+    }
+    double startUs = ToMicroseconds(start);
+    Push({name, 'X', startUs, ToMicroseconds(end) - startUs, nullptr, 0, 0});
+}
+
+void Tracer::AddInstant(const char* name, const char* argName, int argValue) {
+    if (!IsActive()) {
+        return;
+    }
+    Push({name, 'i', ToMicroseconds(std::chrono::steady_clock::now()), 0.0, argName, argValue, 0});
+}
+
+int Tracer::ThreadTrack() {
+    if (traceTrack == 0) {
+        // only named threads are known; the first to record isn't necessarily main
+        threadNames.push_back("worker");
+        traceTrack = (int)threadNames.size();
+    }
+    return traceTrack;
+}
+
+void Tracer::Push(Event event) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (events.empty()) {
+        return; // stopped and restarted in between
+    }
+    event.thread = ThreadTrack();
+    int capacity = (int)events.size();
+    events[next] = event;
+    next = (next + 1) % capacity;
+    if (count < capacity) {
+        count++;
+    } else {
+        dropped++;
+    }
+}
+
+double Tracer::ToMicroseconds(std::chrono::steady_clock::time_point time) const {
+    return std::chrono::duration<double, std::micro>(time - origin).count();
+}
+
+int Tracer::GetEventCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return count;
+}
+
+const Tracer::Event& Tracer::GetEvent(int index) const {
+    int capacity = (int)events.size();
+    int oldest = (next - count + capacity) % capacity;
+    return events[(oldest + index) % capacity];
+}
+
+long long Tracer::GetDroppedCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return dropped;
+}
+
+// Names are identifiers from the code, so they are written without escaping.
+bool Tracer::WriteJson(const char* path) const {
+    FILE* file = std::fopen(path, "w");
+    if (!file) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    std::fprintf(file, "{\"traceEvents\":[\n");
+    // the main thread's track is always listed, even before it records anything
+    int tracks = std::max((int)threadNames.size(), 1);
+    for (int track = 1; track <= tracks; track++) {
+        const char* threadName = track <= (int)threadNames.size() ? threadNames[track - 1] : "main";
+        std::fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                     track == 1 ? "" : ",\n", track, threadName);
+    }
+    for (int i = 0; i < count; i++) {
+        const Event& event = GetEvent(i);
+        std::fprintf(file, ",\n{\"name\":\"%s\",\"cat\":\"fps\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%d",
+                     event.name, event.phase, event.timestampUs, event.thread);
+        if (event.phase == 'X') {
+            std::fprintf(file, ",\"dur\":%.3f", event.durationUs);
+        } else {
+            std::fprintf(file, ",\"s\":\"t\"");
+        }
+        if (event.argName) {
+            std::fprintf(file, ",\"args\":{\"%s\":%d}", event.argName, event.argValue);
+        }
+        std::fprintf(file, "}");
+    }
+    std::fprintf(file, "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"droppedEvents\":%lld}}\n", dropped);
+    std::fclose(file);
+    return true;
+}
@@ -0,0 +1,65 @@
+// Tracer.h
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+// Opt-in timeline of individual frames in the Chrome trace-event format, for
+// chrome://tracing or Perfetto. PROFILE_SCOPE sections become complete ("X")
+// slices and TRACE_INSTANT marks one-off events. Events go into a fixed-size
+// ring, so a long session keeps only the most recent ones. Events may come
+// from any thread; each thread gets its own track, named with SetThreadName.
+class Tracer {
+    public:
+        static constexpr int defaultCapacity = 1 << 16; // events, about 2.5 MB
+
+        struct Event {
+            const char* name;       // must outlive the tracer (string literals)
+            char phase;             // 'X' complete slice, 'i' instant
+            double timestampUs;     // since Start()
+            double durationUs;
+            const char* argName;    // optional single integer argument
+            int argValue;
+            int thread;             // track id, 1 for the first thread to record
+        };
+
+        static Tracer& Get();
+
+        void Start(int capacity = defaultCapacity); // clears earlier events
+        void Stop();
+        bool IsActive() const { return active.load(std::memory_order_relaxed); }
+        void SetThreadName(const char* name); // names the calling thread's track; name must outlive the tracer
+
+        void AddComplete(const char* name, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end);
+        void AddInstant(const char* name, const char* argName = nullptr, int argValue = 0);
+
+        int GetEventCount() const;
+        const Event& GetEvent(int index) const; // 0 is the oldest kept event; read once every recording thread is done
+        long long GetDroppedCount() const;      // events overwritten by the ring
+        bool WriteJson(const char* path) const;
+
+    private:
+        std::vector<Event> events;
+        int next = 0;
+        int count = 0;
+        long long dropped = 0;
+        std::atomic<bool> active{false};
+        std::chrono::steady_clock::time_point origin;
+        std::vector<const char*> threadNames; // index is track id - 1
+        mutable std::mutex mutex;
+
+        int ThreadTrack(); // caller holds mutex
+        void Push(Event event);
+        double ToMicroseconds(std::chrono::steady_clock::time_point time) const;
+};
+
+#ifdef FPS_PROFILER_ENABLED
+#define TRACE_INSTANT(...) Tracer::Get().AddInstant(__VA_ARGS__)
+#else
+#define TRACE_INSTANT(...) do {} while (0)
+#endif
+
+#endif // TRACER_H
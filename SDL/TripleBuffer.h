@@ -0,0 +1,43 @@
+// TripleBuffer.h
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+#include <atomic>
+
+// Hands whole values from one writer thread to one reader thread without
+// either waiting on the other. The writer fills Back() and publishes it;
+// the reader's Acquire() returns the newest published value and keeps it
+// untouched until the next Acquire. Values published between two Acquires
+// are skipped. Slots are reused, so a T that holds vectors stops
+// allocating once all three have grown to size.
+template <typename T>
+class TripleBuffer {
+    public:
+        // ====== Writer ======
+        T& Back() { return slots[back]; }
+        void Publish() {
+            int old = middle.exchange(back | freshBit, std::memory_order_acq_rel);
+            back = old & indexMask;
+        }
+
+        // ====== Reader ======
+        const T& Acquire() {
+            if (middle.load(std::memory_order_relaxed) & freshBit) {
+                int old = middle.exchange(front, std::memory_order_acq_rel);
+                front = old & indexMask;
+            }
+            return slots[front];
+        }
+        const T& Front() const { return slots[front]; } // what the last Acquire returned
+
+    private:
+        static constexpr int indexMask = 3;
+        static constexpr int freshBit = 4; // set on middle when it holds a value the reader hasn't taken
+
+        T slots[3];
+        int back = 0;               // writer only
+        std::atomic<int> middle{1}; // swapped by both sides
+        int front = 2;              // reader only
+};
+
+#endif // TRIPLE_BUFFER_H
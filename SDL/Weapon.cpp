@@ -1,6 +1,7 @@
 // Weapon.cpp
 
 #include "Weapon.h"
+#include "BulletPool.h"
 #include <cmath>
 #include <cstdlib>
 
@@ -77,32 +78,52 @@ int Weapon::GetRequiredLevel() const {
 }
 
 void Weapon::Fire(float startX, float startY, float targetX, float targetY, std::vector<Bullet>& bullets) {
+    Bullet shot[maxPellets];
+    int count = PrepareShot(startX, startY, targetX, targetY, shot);
+    bullets.insert(bullets.end(), shot, shot + count);
+}
+
+void Weapon::Fire(float startX, float startY, float targetX, float targetY, BulletPool& bullets) {
+    Bullet shot[maxPellets];
+    int count = PrepareShot(startX, startY, targetX, targetY, shot);
+    for (int i = 0; i < count; i++) {
+        bullets.Add(shot[i]);
+    }
+}
+
+int Weapon::PrepareShot(float startX, float startY, float targetX, float targetY, Bullet (&shot)[maxPellets]) {
     if (isReloading || currentAmmo <= 0 || cooldown > 0.0f) {
-        return;
+        return 0;
     }
     float dx = targetX - startX;
     float dy = targetY - startY;
     float length = sqrt(dx*dx + dy*dy);
     if (length == 0.0f) {
-        return;
+        return 0;
     }
     dx /= length;
     dy /= length;
 
+    int count = 0;
     if(type == SHOTGUN) {
         // Fire 5 bullets with a spread
         for(int i = -2; i <= 2; i++) {
             float angle = atan2(dy, dx) + i * 0.1f; // small spread
-            bullets.push_back({startX, startY, cos(angle), sin(angle), (float)bulletSpeed, bulletDamage});
+            shot[count++] = {startX, startY, cos(angle), sin(angle), (float)bulletSpeed, bulletDamage};
         }
     } else {
-        bullets.push_back({startX, startY, dx, dy, (float)bulletSpeed, bulletDamage});
+        shot[count++] = {startX, startY, dx, dy, (float)bulletSpeed, bulletDamage};
+    }
+    for (int i = 0; i < count; i++) {
+        shot[i].prevX = startX;
+        shot[i].prevY = startY;
     }
     currentAmmo--;
     if (currentAmmo == 0) {
         StartReload();
     }
     cooldown = 1.0f / fireRate;
+    return count;
 }
 
 void Weapon::StartReload() {
@@ -2,7 +2,6 @@
 #ifndef WEAPON_H
 #define WEAPON_H
 
-#include <SDL2/SDL.h>
 #include <vector>
 #include "Entity.h"
 
@@ -12,8 +11,12 @@ struct Bullet {
     float speed;
     int damage;
     bool toDelete = false;
+    float prevX = 0.0f; // position before the last integration, for render interpolation
+    float prevY = 0.0f;
 };
 
+class BulletPool;
+
 class Weapon {
 public:
     enum WeaponType { PISTOL, SHOTGUN, RIFLE, MACHINEGUN };
@@ -23,6 +26,7 @@ public:
     WeaponType GetType() const;
 
     void Fire(float startX, float startY, float targetX, float targetY, std::vector<Bullet>& bullets);
+    void Fire(float startX, float startY, float targetX, float targetY, BulletPool& bullets);
     float GetCooldown() const;
     void UpdateCooldown(float deltaTime);
     int GetRequiredLevel() const;
@@ -36,6 +40,11 @@ public:
     bool IsReloading() const;
 
 private:
+    static const int maxPellets = 5;
+
+    // Applies ammo/cooldown and fills shot with the bullets to spawn; returns how many
+    int PrepareShot(float startX, float startY, float targetX, float targetY, Bullet (&shot)[maxPellets]);
+
     WeaponType type;
     float fireRate;
     float cooldown;
@@ -0,0 +1,783 @@
+//World.cpp
+
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include "World.h"
+#include "Config.h"
+#include "CombatSystem.h"
+#include "SpawnSystem.h"
+#include "Profiler.h"
+
+// ---------------- Constructor ----------------
+World::World(int mapWidth, int mapHeight) {
+    status = RUNNING;
+    currentLevel = 1;
+    levelTimer = 100.0f;
+    score = 0;
+    player.x = 0.0f;
+    player.y = 0.0f;
+    player.width = PLAYER_SIZE;
+    player.height = PLAYER_SIZE;
+    previousPlayer = player;
+    spawnX = 0.0f;
+    spawnY = 0.0f;
+    playerHP = 30;
+    playerMaxHP = 30;
+    playerInvulnTimer = 0.0f;
+    playerInvulnerable = false;
+    playerBaseSpeed = BASE_PLAYER_SPEED;
+    playerSpeed = playerBaseSpeed;
+    playerMeleeDamage = 25;
+    playerDying = false;
+    playerDeathTimer = 0.0f;
+    playerDeathDuration = 0.6f;
+    firedThisStep = false;
+    speedItemAmount = 50.0f;
+    speedItemDuration = 5.0f;
+    speedItemTimer = 0.0f;
+    speedItemActive = false;
+    tileSize = TILE_SIZE;
+    breakingWallDuration = 0.6f;
+    chaseFieldDirty = true;
+    jobs = nullptr;
+    mapRevision = 0;
+    levelArena = 0;
+    enemyGrid.SetScratchArena(&frameArena);
+    SetSeed(defaultSeed);
+    SetMapSize(mapWidth, mapHeight);
+    ResetLevelStorage(0);
+
+    playerWeapons.push_back(Weapon(Weapon::PISTOL));
+    currentWeaponIndex = 0;
+}
+
+void World::SetSeed(std::uint64_t seed) {
+    this->seed = seed;
+    mapRng.Seed(seed, mapStream);
+    spawnRng.Seed(seed, spawnStream);
+}
+
+std::uint64_t World::GetSeed() const {
+    return seed;
+}
+
+void World::SetMapSize(int mapWidth, int mapHeight) {
+    mapWidth = std::clamp(mapWidth, MIN_MAP_SIZE, MAX_MAP_SIZE);
+    mapHeight = std::clamp(mapHeight, MIN_MAP_SIZE, MAX_MAP_SIZE);
+    tileMap.Resize(mapWidth, mapHeight);
+    freeTiles.Build(tileMap);
+    tileChanges.clear();
+    mapRevision++;
+    chaseFieldDirty = true;
+}
+
+void World::GenerateMap(float spawnX, float spawnY) {
+    this->spawnX = spawnX;
+    this->spawnY = spawnY;
+    player.x = spawnX;
+    player.y = spawnY;
+    previousPlayer = player;
+    SetSeed(seed);
+
+    int playerTileX = (int)((player.x + player.width * 0.5f) / tileSize);
+    int playerTileY = (int)((player.y + player.height * 0.5f) / tileSize);
+
+    int mapWidth = tileMap.GetWidth();
+    int mapHeight = tileMap.GetHeight();
+    for(int y = 0; y < mapHeight; y++) {
+        for(int x = 0; x < mapWidth; x++) {
+            bool nearPlayerSpawn = std::abs(x - playerTileX) <= 1 && std::abs(y - playerTileY) <= 1;
+
+            if(x == 0 || y == 0 || x == mapWidth-1 || y == mapHeight-1) {
+                tileMap.SetTile(x, y, 1, 0); // border wall
+            }
+            else if(!nearPlayerSpawn && mapRng.NextInt(10) == 0) {
+                tileMap.SetTile(x, y, 2, 0); // random wall
+            }
+            else if(!nearPlayerSpawn && mapRng.NextInt(7) == 0) {
+                tileMap.SetTile(x, y, 3, 40); // obstructable objects like a wall.
+            } else {
+                tileMap.SetTile(x, y, 0, 0); // floor
+            }
+        }
+    }
+    freeTiles.Build(tileMap);
+    tileChanges.clear();
+    mapRevision++;
+    chaseFieldDirty = true;
+}
+
+void World::SpawnEnemies(int count, float difficultyMultiplier) {
+    TRACE_INSTANT("SpawnEnemies", "count", count);
+    PlaceEntities({{SpawnSystem::ENEMY, count, 200.0f}}, difficultyMultiplier);
+}
+
+void World::ResetLevelStorage(int enemyCount) {
+    levelArena = 1 - levelArena;
+    Arena& arena = levelArenas[levelArena];
+    arena.Reset();
+    enemies.UseArena(&arena, enemies.Size() + enemyCount);
+    bullets.UseArena(&arena, LEVEL_BULLET_CAPACITY);
+    RebindArena(healthItems, &arena, healthItems.size() + levelHealthItems);
+    RebindArena(speedItems, &arena, speedItems.size() + levelSpeedItems);
+    RebindArena(weaponItems, &arena, weaponItems.size() + levelWeaponItems);
+    RebindArena(wallBreakEffects, &arena, LEVEL_WALL_EFFECT_CAPACITY);
+}
+
+void World::SpawnLevelContents(int enemyCount, float difficultyMultiplier) {
+    TRACE_INSTANT("SpawnEnemies", "count", enemyCount);
+    PlaceEntities({
+        {SpawnSystem::ENEMY, enemyCount, 200.0f}, // enemies don't spawn right next to the player
+        {SpawnSystem::HEALTH_ITEM, levelHealthItems, 100.0f},
+        {SpawnSystem::SPEED_ITEM, levelSpeedItems, 100.0f},
+        {SpawnSystem::WEAPON_ITEM, levelWeaponItems, 100.0f},
+    }, difficultyMultiplier);
+}
+
+void World::PlaceEntities(const std::vector<SpawnSystem::PlacementRequest>& requests, float difficultyMultiplier) {
+    placements.clear();
+    SpawnSystem::PlaceEntities(requests, player, freeTiles, tileSize, spawnRng, placements);
+
+    int counts[4] = {0, 0, 0, 0};
+    for (const SpawnSystem::Placement& placement : placements) {
+        counts[placement.kind]++;
+    }
+    enemies.Reserve(enemies.Size() + counts[SpawnSystem::ENEMY]);
+    healthItems.reserve(healthItems.size() + counts[SpawnSystem::HEALTH_ITEM]);
+    speedItems.reserve(speedItems.size() + counts[SpawnSystem::SPEED_ITEM]);
+    weaponItems.reserve(weaponItems.size() + counts[SpawnSystem::WEAPON_ITEM]);
+
+    for (const SpawnSystem::Placement& placement : placements) {
+        switch (placement.kind) {
+            case SpawnSystem::ENEMY: {
+                Enemy::EnemyType type = static_cast<Enemy::EnemyType>(spawnRng.NextInt(3));
+                enemies.Add(Enemy(placement.x, placement.y, type, currentLevel, difficultyMultiplier));
+                break;
+            }
+            case SpawnSystem::HEALTH_ITEM: {
+                HealthItem item;
+                item.x = placement.x;
+                item.y = placement.y;
+                item.width = PLAYER_SIZE;
+                item.height = PLAYER_SIZE;
+                healthItems.push_back(item);
+                break;
+            }
+            case SpawnSystem::SPEED_ITEM: {
+                SpeedItem item;
+                item.x = placement.x;
+                item.y = placement.y;
+                item.width = PLAYER_SIZE;
+                item.height = PLAYER_SIZE;
+                speedItems.push_back(item);
+                break;
+            }
+            case SpawnSystem::WEAPON_ITEM: {
+                WeaponItem item;
+                item.x = placement.x;
+                item.y = placement.y;
+                item.width = PLAYER_SIZE;
+                item.height = PLAYER_SIZE;
+                item.type = SpawnSystem::WeaponItemForLevel(currentLevel);
+                weaponItems.push_back(item);
+                break;
+            }
+        }
+    }
+}
+
+void World::AddEnemy(float x, float y, Enemy::EnemyType type, float difficultyMultiplier) {
+    enemies.Add(Enemy(x, y, type, currentLevel, difficultyMultiplier));
+}
+
+void World::GivePlayerWeapon(Weapon::WeaponType type) {
+    playerWeapons.push_back(Weapon(type));
+    currentWeaponIndex = (int)playerWeapons.size() - 1;
+}
+
+void World::SetPlayerInvulnerable(bool invulnerable) {
+    playerInvulnerable = invulnerable;
+}
+
+void World::SetJobSystem(JobSystem* newJobs) {
+    jobs = newJobs;
+}
+
+void World::StartNextLevel(float difficultyMultiplier) {
+    currentLevel++;
+    levelTimer = 100.0f;
+    status = RUNNING;
+    enemies.Clear();
+    bullets.Clear();
+    speedItems.clear();
+    weaponItems.clear();
+    ResetLevelStorage(5 + currentLevel);
+    TRACE_INSTANT("LevelStart", "level", currentLevel);
+    SpawnLevelContents(5 + currentLevel, difficultyMultiplier);
+}
+
+void World::Restart(float difficultyMultiplier) {
+    currentLevel = 1;
+    levelTimer = 100.0f;
+    status = RUNNING;
+    player.x = spawnX;
+    player.y = spawnY;
+    previousPlayer = player;
+    enemies.Clear();
+    bullets.Clear();
+    healthItems.clear();
+    speedItems.clear();
+    weaponItems.clear();
+    playerWeapons.clear();
+    playerWeapons.push_back(Weapon(Weapon::PISTOL));
+    currentWeaponIndex = 0;
+    playerSpeed = playerBaseSpeed;
+    speedItemActive = false;
+    speedItemTimer = 0.0f;
+
+    ResetLevelStorage(5);
+    TRACE_INSTANT("LevelStart", "level", currentLevel);
+    SpawnLevelContents(5, difficultyMultiplier);
+    playerHP = 30;
+    playerMaxHP = 30;
+    playerInvulnTimer = 0.0f;
+    score = 0;
+    playerDying = false;
+    playerDeathTimer = 0.0f;
+}
+
+World::Status World::Step(float deltaTime, const InputFrame& input) {
+    PROFILE_SCOPE("Sim.Step");
+    frameArena.Reset();
+    tileChanges.clear(); // the list covers one step, so callers that never clear it don't grow it
+    status = RUNNING;
+    firedThisStep = false;
+    previousPlayer = player;
+    HandleReloadInput(input);
+    UpdatePlayer(deltaTime);
+    if (playerDying) {
+        return status;
+    }
+    UpdateTimer(deltaTime);
+    UpdateBreakingWallTime(deltaTime);
+    UpdateCollision(deltaTime, input.moveX, input.moveY);
+    {
+        PROFILE_SCOPE("Sim.Items");
+        UpdateHealthItems();
+        UpdateSpeedItems(deltaTime);
+        UpdateWeaponItems();
+    }
+    UpdateEnemy(deltaTime, input.meleePressed);
+    UpdateFiring(input);
+    UpdateWeaponCooldown(deltaTime);
+    UpdateReloadCooldown(deltaTime);
+    UpdateBullets(deltaTime);
+    HandleWeaponSelect(input);
+    return status;
+}
+
+void World::HandleReloadInput(const InputFrame& input) {
+    if (input.reloadPressed && !playerWeapons.empty()) {
+        playerWeapons[currentWeaponIndex].StartReload();
+    }
+}
+
+void World::HandleWeaponSelect(const InputFrame& input) {
+    int slot = input.selectWeaponSlot;
+    if (slot < 0 || slot >= (int)playerWeapons.size()) {
+        return;
+    }
+    if (currentLevel >= playerWeapons[slot].GetRequiredLevel()) {
+        currentWeaponIndex = slot;
+    }
+}
+
+void World::UpdatePlayer(float deltaTime) {
+    // If player is currently in death animation, update timer and check if we should switch to game over
+    if (playerDying) {
+        playerDeathTimer -= deltaTime;
+        if (playerDeathTimer <= 0.0f) {
+            playerDeathTimer = 0.0f;
+            status = GAME_OVER;
+        }
+        return;
+    }
+
+    if (playerInvulnTimer > 0.0f)
+        playerInvulnTimer -= deltaTime;
+    if (playerInvulnerable)
+        playerInvulnTimer = 1.0f;
+
+    if (playerHP <= 0) {
+        playerDying = true;
+        playerDeathTimer = playerDeathDuration;
+    }
+}
+
+void World::UpdateTimer(float deltaTime) {
+    levelTimer -= deltaTime;
+    if (levelTimer <= 0.0f) {
+        levelTimer = 0.0f;
+        status = GAME_OVER;
+    }
+}
+
+void World::UpdateBreakingWallTime(float deltaTime) {
+    for (auto& eff : wallBreakEffects) {
+        eff.timer = std::max(0.0f, eff.timer - deltaTime);
+    }
+    wallBreakEffects.erase(
+        std::remove_if(wallBreakEffects.begin(), wallBreakEffects.end(),
+            [](const WallBreakEffect& e){ return e.timer <= 0.0f; }),
+        wallBreakEffects.end()
+    );
+}
+
+void World::UpdateCollision(float deltaTime, float dx, float dy) {
+    PROFILE_SCOPE("Sim.Collision");
+    // Enemies stay put until UpdateEnemy, so this grid also serves the melee check
+    CombatSystem::BuildEnemyGrid(enemyGrid, enemies);
+    CombatSystem::UpdatePlayerCollision(
+        deltaTime,
+        dx,
+        dy,
+        player,
+        enemies,
+        enemyGrid,
+        playerInvulnTimer,
+        playerSpeed,
+        playerHP,
+        GetCollisionView()
+    );
+}
+
+void World::UpdateHealthItems() {
+    for (auto &h : healthItems) {
+        if (!h.collected) {
+            Entity itemEntity{h.x, h.y, h.width, h.height};
+            if (CombatSystem::AABB(player, itemEntity)) {
+                playerHP += (int)(playerMaxHP * 0.2f); // heal 20%
+                if (playerHP > playerMaxHP)
+                    playerHP = playerMaxHP;
+                h.collected = true;
+            }
+        }
+    }
+
+    healthItems.erase(
+        std::remove_if(healthItems.begin(), healthItems.end(),
+            [](const HealthItem &h){ return h.collected; }),
+        healthItems.end()
+    );
+}
+
+void World::UpdateSpeedItems(float deltaTime) {
+    if (speedItemActive) {
+        speedItemTimer -= deltaTime;
+        if (speedItemTimer <= 0.0f) {
+            speedItemTimer = 0.0f;
+            playerSpeed = playerBaseSpeed;
+            speedItemActive = false;
+        }
+    }
+
+    for (auto &s : speedItems) {
+        if (!s.collected) {
+            Entity itemEntity{s.x, s.y, s.width, s.height};
+            if (CombatSystem::AABB(player, itemEntity)) {
+                if (!speedItemActive) {
+                    playerSpeed = playerBaseSpeed + speedItemAmount;
+                    speedItemTimer = speedItemDuration;
+                    speedItemActive = true;
+                    s.collected = true;
+                }
+            }
+        }
+    }
+
+    speedItems.erase(
+        std::remove_if(speedItems.begin(), speedItems.end(),
+            [](const SpeedItem &s){ return s.collected; }),
+        speedItems.end()
+    );
+}
+
+void World::UpdateWeaponItems() {
+    //only add weapon to inventory if not already owned
+    if (currentLevel == 2) {
+        // only spawn rifle in level 2
+        for (auto &w : weaponItems) {
+            if (w.type != Weapon::RIFLE) {
+                w.collected = true;
+            }
+        }
+    }
+
+    if (currentLevel == 3) {
+        // only spawn shotgun in level 3
+        for (auto &w : weaponItems) {
+            if (w.type != Weapon::SHOTGUN) {
+                w.collected = true;
+            }
+        }
+    }
+
+    if (currentLevel == 4) {
+        // only spawn machinegun in level 4
+        for (auto &w : weaponItems) {
+            if (w.type != Weapon::MACHINEGUN) {
+                w.collected = true;
+            }
+        }
+    }
+
+    for (auto &w : weaponItems) {
+        if (!w.collected) {
+            Entity itemEntity{w.x, w.y, w.width, w.height};
+            if (CombatSystem::AABB(player, itemEntity)) {
+                // Add weapon to inventory if not already owned
+                bool alreadyOwned = false;
+                for (auto &wp : playerWeapons) {
+                    if (wp.GetType() == w.type) {
+                        alreadyOwned = true;
+                        break;
+                    }
+                }
+                if (!alreadyOwned)
+                    playerWeapons.push_back(Weapon(w.type));
+
+                w.collected = true;
+            }
+        }
+    }
+
+    // remove collected items
+    weaponItems.erase(
+        std::remove_if(weaponItems.begin(), weaponItems.end(),
+            [](const WeaponItem &w){ return w.collected; }),
+        weaponItems.end()
+    );
+}
+
+void World::UpdateChaseField() {
+    int goalTileX = (int)std::floor((player.x + player.width * 0.5f) / tileSize);
+    int goalTileY = (int)std::floor((player.y + player.height * 0.5f) / tileSize);
+    if (!chaseFieldDirty && chaseField.IsBuilt() &&
+        chaseField.GetGoalTileX() == goalTileX && chaseField.GetGoalTileY() == goalTileY) {
+        return;
+    }
+    chaseField.Build(GetCollisionView(), goalTileX, goalTileY);
+    chaseFieldDirty = false;
+}
+
+void World::UpdateEnemy(float deltaTime, bool meleePressed) {
+    PROFILE_SCOPE("Sim.Enemy");
+    UpdateChaseField();
+    int enemiesBefore = enemies.Size();
+    bool levelComplete = false;
+    CombatSystem::UpdateEnemy(
+        deltaTime,
+        enemies,
+        enemyGrid,
+        player,
+        playerMeleeDamage,
+        GetCollisionView(),
+        chaseField,
+        meleePressed,
+        levelComplete,
+        jobs
+    );
+
+    int enemiesAfter = enemies.Size();
+    int kills = enemiesBefore - enemiesAfter;
+    AddKillScore(kills);
+
+    if (levelComplete) {
+        status = LEVEL_COMPLETE;
+    }
+}
+
+void World::UpdateFiring(const InputFrame& input) {
+    int bulletsBefore = bullets.Size();
+    CombatSystem::DetectMouseClick(
+        player,
+        playerWeapons,
+        currentWeaponIndex,
+        bullets,
+        input.aimX,
+        input.aimY,
+        input.firePressed
+    );
+    firedThisStep = bullets.Size() > bulletsBefore;
+}
+
+void World::UpdateWeaponCooldown(float deltaTime) {
+    if (!playerWeapons.empty())
+        playerWeapons[currentWeaponIndex].UpdateCooldown(deltaTime);
+}
+
+void World::UpdateReloadCooldown(float deltaTime) {
+    if (!playerWeapons.empty())
+        playerWeapons[currentWeaponIndex].UpdateReloadCooldown(deltaTime);
+}
+
+void World::UpdateBullets(float deltaTime) {
+    PROFILE_SCOPE("Sim.Bullets");
+    int enemiesBefore = enemies.Size();
+    // Enemies moved and may have been removed since the last build
+    CombatSystem::BuildEnemyGrid(enemyGrid, enemies);
+    CombatSystem::UpdateBullets(
+        deltaTime,
+        bullets,
+        enemies,
+        enemyGrid,
+        GetCollisionView(),
+        [this](float x, float y, int damage) {
+            DamageTileAtWorld(x, y, damage);
+        }
+    );
+
+    int enemiesAfter = enemies.Size();
+    int kills = enemiesBefore - enemiesAfter;
+    AddKillScore(kills);
+}
+
+void World::AddKillScore(int kills) {
+    if (kills <= 0) {
+        return;
+    }
+
+    float timeLeft = std::max(0.0f, levelTimer);
+    score += (int)((timeLeft / 2.0f) * kills);
+}
+
+// return true if collision, false if no collision
+bool World::DetectCollision(const Entity& entity, float nextX, float nextY) const {
+    return GetCollisionView().Collides(entity, nextX, nextY);
+}
+
+bool World::IsSolidTile(int x, int y) const {
+    return GetCollisionView().IsSolidTile(x, y);
+}
+
+TileCollisionView World::GetCollisionView() const {
+    TileCollisionView view;
+    view.map = &tileMap;
+    view.tileSize = tileSize;
+    return view;
+}
+
+void World::DamageTileAtWorld(float worldX, float worldY, int damage) {
+    int tileX = (int)(worldX / tileSize);
+    int tileY = (int)(worldY / tileSize);
+    if (!tileMap.InBounds(tileX, tileY))
+        return;
+
+    if (tileMap.GetType(tileX, tileY) != 3) return;
+
+    // Push a new effect (or reset existing one at same tile)
+    float wx = tileX * tileSize + tileSize / 2.0f;
+    float wy = tileY * tileSize + tileSize / 2.0f;
+    bool found = false;
+    for (auto& eff : wallBreakEffects) {
+        if ((int)eff.worldX == (int)wx && (int)eff.worldY == (int)wy) {
+            eff.timer = breakingWallDuration;
+            found = true;
+            break;
+        }
+    }
+    if (!found) {
+        wallBreakEffects.push_back({wx, wy, breakingWallDuration});
+    }
+
+    int hp = tileMap.GetHP(tileX, tileY) - damage;
+    if (hp <= 0) {
+        tileMap.SetTile(tileX, tileY, 0, 0); // turn into floor
+        tileChanges.push_back({tileX, tileY});
+        freeTiles.Add(tileX, tileY);
+        chaseFieldDirty = true;
+        TRACE_INSTANT("WallBreak", "tile", tileY * tileMap.GetWidth() + tileX);
+    } else {
+        tileMap.SetHP(tileX, tileY, hp);
+    }
+}
+
+int World::GetTile(int x, int y) const {
+    return tileMap.GetType(x, y);
+}
+
+int World::GetTileSize() const {
+    return tileSize;
+}
+
+int World::GetMapWidth() const {
+    return tileMap.GetWidth();
+}
+
+int World::GetMapHeight() const {
+    return tileMap.GetHeight();
+}
+
+const TileMap& World::GetTileMap() const {
+    return tileMap;
+}
+
+const FreeTileIndex& World::GetFreeTiles() const {
+    return freeTiles;
+}
+
+int World::GetMapRevision() const {
+    return mapRevision;
+}
+
+const std::vector<World::TileChange>& World::GetTileChanges() const {
+    return tileChanges;
+}
+
+void World::ClearTileChanges() {
+    tileChanges.clear();
+}
+
+const Entity& World::GetPlayer() const {
+    return player;
+}
+
+const Entity& World::GetPreviousPlayer() const {
+    return previousPlayer;
+}
+
+int World::GetPlayerHP() const {
+    return playerHP;
+}
+
+int World::GetPlayerMaxHP() const {
+    return playerMaxHP;
+}
+
+float World::GetPlayerInvulnTimer() const {
+    return playerInvulnTimer;
+}
+
+bool World::IsPlayerDying() const {
+    return playerDying;
+}
+
+float World::GetPlayerDeathProgress() const {
+    return 1.0f - (playerDeathTimer / playerDeathDuration);
+}
+
+bool World::FiredThisStep() const {
+    return firedThisStep;
+}
+
+const std::vector<Weapon>& World::GetPlayerWeapons() const {
+    return playerWeapons;
+}
+
+int World::GetCurrentWeaponIndex() const {
+    return currentWeaponIndex;
+}
+
+const EnemyPool& World::GetEnemies() const {
+    return enemies;
+}
+
+const FlowField& World::GetChaseField() const {
+    return chaseField;
+}
+
+const BulletPool& World::GetBullets() const {
+    return bullets;
+}
+
+const ArenaVector<HealthItem>& World::GetHealthItems() const {
+    return healthItems;
+}
+
+const ArenaVector<SpeedItem>& World::GetSpeedItems() const {
+    return speedItems;
+}
+
+const ArenaVector<WeaponItem>& World::GetWeaponItems() const {
+    return weaponItems;
+}
+
+const ArenaVector<World::WallBreakEffect>& World::GetWallBreakEffects() const {
+    return wallBreakEffects;
+}
+
+float World::GetBreakingWallDuration() const {
+    return breakingWallDuration;
+}
+
+int World::GetLevel() const {
+    return currentLevel;
+}
+
+float World::GetLevelTimer() const {
+    return levelTimer;
+}
+
+int World::GetScore() const {
+    return score;
+}
+
+namespace {
+struct StateHasher {
+    std::uint64_t value = 14695981039346656037ULL;
+
+    void AddBytes(const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; i++) {
+            value = (value ^ bytes[i]) * 1099511628211ULL;
+        }
+    }
+
+    template<typename T>
+    void Add(T field) {
+        AddBytes(&field, sizeof(field));
+    }
+};
+}
+
+// Covers everything a Step can change; floats are hashed by bit pattern, so
+// any divergence between builds shows up.
+std::uint64_t World::ComputeStateHash() const {
+    StateHasher hasher;
+    hasher.Add((int)status);
+    hasher.Add(currentLevel);
+    hasher.Add(levelTimer);
+    hasher.Add(score);
+    hasher.Add(player.x);
+    hasher.Add(player.y);
+    hasher.Add(playerHP);
+    hasher.Add(playerSpeed);
+    hasher.Add(currentWeaponIndex);
+    for (const Weapon& weapon : playerWeapons) {
+        hasher.Add((int)weapon.GetType());
+        hasher.Add(weapon.GetCurrentAmmo());
+    }
+    hasher.Add(enemies.Size());
+    for (int i = 0; i < enemies.Size(); i++) {
+        hasher.Add(enemies.GetX(i));
+        hasher.Add(enemies.GetY(i));
+        hasher.Add(enemies.GetHP(i));
+        hasher.Add((int)enemies.GetType(i));
+    }
+    hasher.Add(bullets.Size());
+    for (int i = 0; i < bullets.Size(); i++) {
+        hasher.Add(bullets.GetX(i));
+        hasher.Add(bullets.GetY(i));
+    }
+    hasher.Add(healthItems.size());
+    hasher.Add(speedItems.size());
+    hasher.Add(weaponItems.size());
+    for (int y = 0; y < tileMap.GetHeight(); y++) {
+        for (int x = 0; x < tileMap.GetWidth(); x++) {
+            hasher.Add(tileMap.GetType(x, y));
+            hasher.Add(tileMap.GetHP(x, y));
+        }
+    }
+    return hasher.value;
+}
@@ -0,0 +1,197 @@
+// World.h
+#ifndef WORLD_H
+#define WORLD_H
+
+#include <vector>
+#include "Entity.h"
+#include "Enemy.h"
+#include "Weapon.h"
+#include "Items.h"
+#include "InputFrame.h"
+#include "Config.h"
+#include "TileMap.h"
+#include "SpatialHash.h"
+#include "BulletPool.h"
+#include "EnemyPool.h"
+#include "JobSystem.h"
+#include "TileCollisionView.h"
+#include "FlowField.h"
+#include "FreeTileIndex.h"
+#include "SpawnSystem.h"
+#include "Rng.h"
+#include "Arena.h"
+
+// All gameplay state and rules, with no window or renderer attached.
+// Game drives it with one Step() per update; tests and tools can tick it headless.
+class World {
+    public:
+        enum Status { RUNNING, LEVEL_COMPLETE, GAME_OVER };
+
+        struct WallBreakEffect {
+            float worldX, worldY;
+            float timer;
+        };
+
+        struct TileChange {
+            int x, y;
+        };
+
+        World(int mapWidth = DEFAULT_MAP_WIDTH, int mapHeight = DEFAULT_MAP_HEIGHT);
+
+        // ====== Level Flow ======
+        static constexpr std::uint64_t defaultSeed = 0x5eed;
+
+        void SetSeed(std::uint64_t seed); // takes effect from the next GenerateMap
+        std::uint64_t GetSeed() const;
+        void SetMapSize(int mapWidth, int mapHeight); // clears the map, call GenerateMap after
+        void GenerateMap(float spawnX, float spawnY); // restarts both random streams from the seed
+        void SpawnEnemies(int count, float difficultyMultiplier);
+        void StartNextLevel(float difficultyMultiplier);
+        void Restart(float difficultyMultiplier);
+        Status Step(float deltaTime, const InputFrame& input);
+
+        // ====== Scripted Setup ======
+        // Direct setup for benchmarks and tests that need a specific situation.
+        void AddEnemy(float x, float y, Enemy::EnemyType type, float difficultyMultiplier);
+        void GivePlayerWeapon(Weapon::WeaponType type); // adds it and switches to it, whatever the level
+        void SetPlayerInvulnerable(bool invulnerable);  // enemies can't hurt the player
+
+        // ====== Threads ======
+        void SetJobSystem(JobSystem* jobs); // not owned; null runs everything on the calling thread
+
+        // ====== Map ======
+        bool DetectCollision(const Entity& entity, float nextX, float nextY) const;
+        bool IsSolidTile(int x, int y) const; // out of bounds counts as solid
+        TileCollisionView GetCollisionView() const; // valid while this World is alive
+        void DamageTileAtWorld(float worldX, float worldY, int damage);
+        int GetTile(int x, int y) const;
+        int GetTileSize() const;
+        int GetMapWidth() const;
+        int GetMapHeight() const;
+        const TileMap& GetTileMap() const;
+        const FreeTileIndex& GetFreeTiles() const;
+        int GetMapRevision() const; // bumped whenever the whole map is replaced
+        // tiles changed by the last Step and by any damage since; Step starts the list over
+        const std::vector<TileChange>& GetTileChanges() const;
+        void ClearTileChanges();
+
+        // ====== State Queries ======
+        const Entity& GetPlayer() const;
+        const Entity& GetPreviousPlayer() const;
+        int GetPlayerHP() const;
+        int GetPlayerMaxHP() const;
+        float GetPlayerInvulnTimer() const;
+        bool IsPlayerDying() const;
+        float GetPlayerDeathProgress() const;
+        bool FiredThisStep() const;
+        const std::vector<Weapon>& GetPlayerWeapons() const;
+        int GetCurrentWeaponIndex() const;
+        const EnemyPool& GetEnemies() const;
+        const FlowField& GetChaseField() const;
+        const BulletPool& GetBullets() const;
+        const ArenaVector<HealthItem>& GetHealthItems() const;
+        const ArenaVector<SpeedItem>& GetSpeedItems() const;
+        const ArenaVector<WeaponItem>& GetWeaponItems() const;
+        const ArenaVector<WallBreakEffect>& GetWallBreakEffects() const;
+        float GetBreakingWallDuration() const;
+        int GetLevel() const;
+        float GetLevelTimer() const;
+        int GetScore() const;
+        std::uint64_t ComputeStateHash() const; // FNV-1a over gameplay state, for comparing replays across builds
+
+    private:
+        Status status;
+        int currentLevel;
+        float levelTimer;
+        int score;
+
+        // ====== Player ======
+        Entity player;
+        Entity previousPlayer; // player at the start of the last Step, for render interpolation
+        float spawnX;
+        float spawnY;
+        int playerHP;
+        int playerMaxHP;
+        float playerInvulnTimer;
+        bool playerInvulnerable;
+        float playerBaseSpeed;
+        float playerSpeed;
+        int playerMeleeDamage;
+        bool playerDying;
+        float playerDeathTimer;
+        float playerDeathDuration;
+        bool firedThisStep;
+
+        // ====== Entities ======
+        EnemyPool enemies; // grouped by type, see EnemyPool
+        SpatialHash enemyGrid; // live enemies, rebuilt before each batch of queries
+        FlowField chaseField; // paths to the player's tile, shared by every smart enemy
+        bool chaseFieldDirty; // set when walls change; the player's tile is checked every tick
+        BulletPool bullets;
+        JobSystem* jobs; // enemy movement runs over these threads when set
+        std::vector<Weapon> playerWeapons;
+        int currentWeaponIndex;
+        ArenaVector<HealthItem> healthItems;
+        ArenaVector<SpeedItem> speedItems;
+        ArenaVector<WeaponItem> weaponItems;
+
+        float speedItemDuration;
+        float speedItemTimer;
+        float speedItemAmount;
+        bool speedItemActive;
+
+        // ====== Random ======
+        // Separate streams so changing how many spawn draws a level makes
+        // never shifts the map layout, and vice versa.
+        static constexpr std::uint64_t mapStream = 1;
+        static constexpr std::uint64_t spawnStream = 2;
+        std::uint64_t seed;
+        Rng mapRng;
+        Rng spawnRng;
+
+        // ====== Map ======
+        TileMap tileMap;
+        FreeTileIndex freeTiles; // walkable tiles, for spawning
+        int tileSize;
+        int mapRevision;
+        std::vector<TileChange> tileChanges;
+        ArenaVector<WallBreakEffect> wallBreakEffects;
+        float breakingWallDuration;
+
+        std::vector<SpawnSystem::Placement> placements; // reused by every spawn batch
+
+        // ====== Storage ======
+        // Enemies, bullets, items and wall effects live in a level arena,
+        // reserved from the level's spawn counts when it starts. Each level
+        // start moves them into the other arena, so the one being reset is
+        // never still in use and whatever carries over keeps its contents.
+        // Scratch space for one Step comes from frameArena.
+        static constexpr int levelHealthItems = 2;
+        static constexpr int levelSpeedItems = 1;
+        static constexpr int levelWeaponItems = 1;
+        Arena levelArenas[2];
+        int levelArena; // the one in use
+        Arena frameArena;
+
+        void ResetLevelStorage(int enemyCount);
+        void SpawnLevelContents(int enemyCount, float difficultyMultiplier);
+        void PlaceEntities(const std::vector<SpawnSystem::PlacementRequest>& requests, float difficultyMultiplier);
+        void UpdatePlayer(float deltaTime);
+        void UpdateTimer(float deltaTime);
+        void UpdateBreakingWallTime(float deltaTime);
+        void UpdateCollision(float deltaTime, float dx, float dy);
+        void UpdateHealthItems();
+        void UpdateSpeedItems(float deltaTime);
+        void UpdateWeaponItems();
+        void UpdateEnemy(float deltaTime, bool meleePressed);
+        void UpdateChaseField();
+        void UpdateFiring(const InputFrame& input);
+        void UpdateWeaponCooldown(float deltaTime);
+        void UpdateReloadCooldown(float deltaTime);
+        void UpdateBullets(float deltaTime);
+        void HandleReloadInput(const InputFrame& input);
+        void HandleWeaponSelect(const InputFrame& input);
+        void AddKillScore(int kills);
+};
+
+#endif // WORLD_H
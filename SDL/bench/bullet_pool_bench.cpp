@@ -0,0 +1,66 @@
+// bullet_pool_bench.cpp
+// Position integration cost per bullet: the old vector<Bullet> loop against
+// BulletPool's SoA kernel, from a few hundred pellets up to stress-run counts.
+
+#include "BulletPool.h"
+#include "Weapon.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+template <typename Fn>
+double BestMilliseconds(int repeats, Fn&& fn) {
+    double best = 1e30;
+    for (int r = 0; r < repeats; r++) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        if (ms < best) best = ms;
+    }
+    return best;
+}
+}
+
+int main() {
+    const int bulletCounts[] = {500, 5000, 50000, 200000};
+    const int ticks = 100;
+    const float dt = 1.0f / 120.0f;
+
+    std::printf("%8s %14s %14s %8s\n", "bullets", "AoS ns/bullet", "SoA ns/bullet", "speedup");
+    for (int count : bulletCounts) {
+        std::vector<Bullet> aos;
+        BulletPool pool;
+        pool.Reserve(count);
+        for (int i = 0; i < count; i++) {
+            float angle = i * 0.01f;
+            Bullet b{(float)i, (float)-i, std::cos(angle), std::sin(angle), 450.0f, 80};
+            aos.push_back(b);
+            pool.Add(b);
+        }
+
+        double aosMs = BestMilliseconds(5, [&]() {
+            for (int t = 0; t < ticks; t++) {
+                for (auto& bullet : aos) {
+                    bullet.prevX = bullet.x;
+                    bullet.prevY = bullet.y;
+                    bullet.x += bullet.dx * bullet.speed * dt;
+                    bullet.y += bullet.dy * bullet.speed * dt;
+                }
+            }
+        });
+        double soaMs = BestMilliseconds(5, [&]() {
+            for (int t = 0; t < ticks; t++) {
+                pool.Integrate(dt);
+            }
+        });
+
+        double perBullet = 1e6 / ((double)count * ticks);
+        std::printf("%8d %14.3f %14.3f %7.1fx\n", count, aosMs * perBullet, soaMs * perBullet, aosMs / soaMs);
+    }
+    return 0;
+}
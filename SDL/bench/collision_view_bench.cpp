@@ -0,0 +1,93 @@
+// collision_view_bench.cpp
+// Per-query cost of the tile collision test: the old std::function callback
+// wrapping World::DetectCollision against a TileCollisionView the compiler
+// can inline into the calling loop.
+
+#include "World.h"
+#include "TileCollisionView.h"
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace {
+
+struct Query {
+    Entity entity;
+    float nextX;
+    float nextY;
+};
+
+template <typename Fn>
+double BestMilliseconds(int repeats, Fn&& fn) {
+    double best = 1e30;
+    for (int r = 0; r < repeats; r++) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        if (ms < best) best = ms;
+    }
+    return best;
+}
+
+// noinline so both variants pay for one real call into the query loop
+__attribute__((noinline)) int CountWithCallback(
+    const std::vector<Query>& queries,
+    const std::function<bool(const Entity&, float, float)>& collisionFunc) {
+    int hits = 0;
+    for (const Query& q : queries) {
+        hits += collisionFunc(q.entity, q.nextX, q.nextY) ? 1 : 0;
+    }
+    return hits;
+}
+
+__attribute__((noinline)) int CountWithView(const std::vector<Query>& queries, const TileCollisionView& tiles) {
+    int hits = 0;
+    for (const Query& q : queries) {
+        hits += tiles.Collides(q.entity, q.nextX, q.nextY) ? 1 : 0;
+    }
+    return hits;
+}
+}
+
+int main() {
+    World world;
+    world.GenerateMap(400.0f, 300.0f);
+    float worldSize = (float)(world.GetMapWidth() * world.GetTileSize());
+
+    // mix of player/enemy sized boxes and 5x5 bullets, like one tick's worth of moves
+    std::mt19937 rng(42u);
+    std::uniform_real_distribution<float> position(0.0f, worldSize);
+    std::vector<Query> queries;
+    const int queryCount = 1000000;
+    queries.reserve(queryCount);
+    for (int i = 0; i < queryCount; i++) {
+        float size = (i % 3 == 0) ? 5.0f : 50.0f;
+        float x = position(rng);
+        float y = position(rng);
+        queries.push_back(Query{Entity{x, y, size, size}, x + 2.0f, y - 1.0f});
+    }
+
+    std::function<bool(const Entity&, float, float)> callback =
+        [&world](const Entity& ent, float x, float y) {
+            return world.DetectCollision(ent, x, y);
+        };
+    TileCollisionView tiles = world.GetCollisionView();
+
+    int callbackHits = 0;
+    int viewHits = 0;
+    double callbackMs = BestMilliseconds(5, [&]() { callbackHits = CountWithCallback(queries, callback); });
+    double viewMs = BestMilliseconds(5, [&]() { viewHits = CountWithView(queries, tiles); });
+    if (callbackHits != viewHits) {
+        std::fprintf(stderr, "hit mismatch: callback %d, view %d\n", callbackHits, viewHits);
+        return 1;
+    }
+
+    std::printf("%-28s %10.2f ns/query\n", "std::function callback", callbackMs * 1e6 / queryCount);
+    std::printf("%-28s %10.2f ns/query\n", "TileCollisionView (inline)", viewMs * 1e6 / queryCount);
+    std::printf("%-28s %10.1fx\n", "speedup", callbackMs / viewMs);
+    return 0;
+}
@@ -0,0 +1,80 @@
+// flow_field_bench.cpp
+// One flow field build per player tile change, then every chaser samples it.
+// Build cost depends on the searched window only; per-chaser cost stays constant.
+
+#include "FlowField.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+
+template <typename Fn>
+double BestMilliseconds(int repeats, Fn&& fn) {
+    double best = 1e30;
+    for (int r = 0; r < repeats; r++) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        if (ms < best) best = ms;
+    }
+    return best;
+}
+}
+
+int main() {
+    const int mapSizes[] = {16, 64, 256, 1024, 4096};
+    const int chaserCounts[] = {10, 100, 1000};
+    const int tileSize = 50;
+
+    std::printf("%6s %14s %14s", "map", "full build ms", "build ms");
+    for (int chasers : chaserCounts) {
+        std::printf(" %9d chasers ns/each", chasers);
+    }
+    std::printf("\n");
+
+    for (int size : mapSizes) {
+        // border plus ~10% random walls, like GenerateMap
+        std::mt19937 rng(7u);
+        TileMap map(size, size);
+        for (int y = 0; y < size; y++) {
+            for (int x = 0; x < size; x++) {
+                bool border = x == 0 || y == 0 || x == size - 1 || y == size - 1;
+                map.SetTile(x, y, (border || rng() % 10 == 0) ? 2 : 0, 0);
+            }
+        }
+        int goal = size / 2;
+        map.SetTile(goal, goal, 0, 0);
+        TileCollisionView tiles{&map, tileSize};
+
+        // whole map, as if the chase radius were unbounded, then the windowed build the game uses
+        FlowField field;
+        double fullBuildMs = BestMilliseconds(5, [&]() { field.Build(tiles, goal, goal, size); });
+        double buildMs = BestMilliseconds(5, [&]() { field.Build(tiles, goal, goal); });
+        std::printf("%6d %14.3f %14.3f", size, fullBuildMs, buildMs);
+
+        std::uniform_real_distribution<float> position(0.0f, (float)(size * tileSize));
+        for (int chasers : chaserCounts) {
+            std::vector<float> xs(chasers), ys(chasers);
+            for (int i = 0; i < chasers; i++) {
+                xs[i] = position(rng);
+                ys[i] = position(rng);
+            }
+            float sink = 0.0f;
+            double sampleMs = BestMilliseconds(5, [&]() {
+                for (int i = 0; i < chasers; i++) {
+                    float dirX = 0.0f;
+                    float dirY = 0.0f;
+                    field.Steer(xs[i], ys[i], dirX, dirY);
+                    sink += dirX + dirY;
+                }
+            });
+            std::printf(" %24.1f", sampleMs * 1e6 / chasers + sink * 0.0f);
+        }
+        std::printf("\n");
+    }
+    return 0;
+}
@@ -0,0 +1,171 @@
+// fps_bench.cpp
+// Scripted gameplay scenarios run headless through World, with no window or
+// SDL. Prints one CSV row per scenario so results can be tracked over time:
+//   fps_bench                 every scenario
+//   fps_bench NAME...         only the named scenarios
+// ns per entity update divides the loop time by the enemies and bullets alive
+// at each tick; allocations are counted inside the timed loop only.
+
+#include "World.h"
+#include "Rng.h"
+#include "AllocTracker.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+const int mapSize = 64;
+const float spawnPoint = mapSize * TILE_SIZE * 0.5f;
+
+struct Scenario {
+    const char* name;
+    float seconds;                    // simulated time
+    void (*setup)(World& world);
+    void (*script)(int tick, const World& world, InputFrame& input);
+};
+
+struct Result {
+    int ticks;
+    double wallMs;
+    long long entityUpdates;
+    long long allocations;
+    long long bytes;
+    int enemiesLeft;
+};
+
+void BuildWorld(World& world) {
+    world.SetMapSize(mapSize, mapSize);
+    world.SetSeed(7);
+    world.GenerateMap(spawnPoint, spawnPoint);
+    world.Restart(1.0f);
+    world.SetPlayerInvulnerable(true); // keep the player alive so every tick does the full update
+}
+
+// Enemies on random floor tiles at least 5 tiles from the player.
+void AddEnemies(World& world, int count, Enemy::EnemyType type) {
+    Rng rng(11, (std::uint64_t)type);
+    int playerTile = (int)(spawnPoint / TILE_SIZE);
+    for (int placed = 0; placed < count;) {
+        int x = 1 + rng.NextInt(mapSize - 2);
+        int y = 1 + rng.NextInt(mapSize - 2);
+        if (world.IsSolidTile(x, y) || (std::abs(x - playerTile) < 5 && std::abs(y - playerTile) < 5)) {
+            continue;
+        }
+        world.AddEnemy((float)(x * TILE_SIZE), (float)(y * TILE_SIZE), type, 1.0f);
+        placed++;
+    }
+}
+
+void SetupHorizontal(World& world) {
+    BuildWorld(world);
+    AddEnemies(world, 500, Enemy::horizontalEnemy);
+}
+
+void SetupVertical(World& world) {
+    BuildWorld(world);
+    AddEnemies(world, 500, Enemy::verticalEnemy);
+}
+
+void SetupSmart(World& world) {
+    BuildWorld(world);
+    AddEnemies(world, 500, Enemy::smartEnemy);
+}
+
+void SetupMachineGun(World& world) {
+    BuildWorld(world);
+    AddEnemies(world, 50, Enemy::smartEnemy);
+    world.GivePlayerWeapon(Weapon::MACHINEGUN);
+}
+
+void SetupShotgun(World& world) {
+    BuildWorld(world);
+    world.GivePlayerWeapon(Weapon::SHOTGUN);
+}
+
+void Idle(int, const World&, InputFrame&) {
+}
+
+// Hold the trigger while the aim sweeps a full circle every 4 seconds.
+void FireSweeping(int tick, const World& world, InputFrame& input) {
+    const Entity& player = world.GetPlayer();
+    float angle = tick * (6.2831853f / (4.0f * SIM_TICK_RATE));
+    input.aimX = player.x + std::cos(angle) * 300.0f;
+    input.aimY = player.y + std::sin(angle) * 300.0f;
+    input.firePressed = true;
+}
+
+// Shotgun into the walls around the player, walking along a row to reach fresh ones.
+void FireAndWalk(int tick, const World& world, InputFrame& input) {
+    FireSweeping(tick, world, input);
+    int leg = (tick / (int)(2.0f * SIM_TICK_RATE)) % 4;
+    input.moveX = leg == 0 ? 1.0f : (leg == 2 ? -1.0f : 0.0f);
+    input.moveY = leg == 1 ? 1.0f : (leg == 3 ? -1.0f : 0.0f);
+}
+
+const Scenario scenarios[] = {
+    {"enemies_horizontal_500", 10.0f, SetupHorizontal, Idle},
+    {"enemies_vertical_500", 10.0f, SetupVertical, Idle},
+    {"enemies_smart_500", 10.0f, SetupSmart, Idle},
+    {"machinegun_60s", 60.0f, SetupMachineGun, FireSweeping},
+    {"shotgun_walls_30s", 30.0f, SetupShotgun, FireAndWalk},
+};
+
+Result Run(const Scenario& scenario) {
+    World world;
+    scenario.setup(world);
+    float stepSize = 1.0f / SIM_TICK_RATE;
+    int ticks = (int)std::lround(scenario.seconds * SIM_TICK_RATE);
+
+    // inputs are scripted up front so the timed loop only steps the world
+    Result result = {ticks, 0.0, 0, 0, 0, 0};
+    AllocTracker& tracker = AllocTracker::Get();
+    long long allocationsBefore = tracker.GetTotalAllocations();
+    long long bytesBefore = tracker.GetTotalBytes();
+    auto start = std::chrono::steady_clock::now();
+    for (int tick = 0; tick < ticks; tick++) {
+        InputFrame input;
+        scenario.script(tick, world, input);
+        result.entityUpdates += world.GetEnemies().Size() + world.GetBullets().Size();
+        world.Step(stepSize, input);
+    }
+    auto end = std::chrono::steady_clock::now();
+    result.wallMs = std::chrono::duration<double, std::milli>(end - start).count();
+    result.allocations = tracker.GetTotalAllocations() - allocationsBefore;
+    result.bytes = tracker.GetTotalBytes() - bytesBefore;
+    result.enemiesLeft = world.GetEnemies().Size();
+    return result;
+}
+
+bool Selected(const char* name, int argc, char* argv[]) {
+    if (argc < 2) {
+        return true;
+    }
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+}
+
+int main(int argc, char* argv[]) {
+    std::printf("scenario,ticks,wall_ms,ticks_per_s,entity_updates,ns_per_entity_update,allocations,allocated_bytes,enemies_left\n");
+    for (const Scenario& scenario : scenarios) {
+        if (!Selected(scenario.name, argc, argv)) {
+            continue;
+        }
+        Result result = Run(scenario);
+        double nsPerEntity = result.entityUpdates > 0 ? result.wallMs * 1e6 / result.entityUpdates : 0.0;
+        std::printf("%s,%d,%.3f,%.1f,%lld,%.2f,%lld,%lld,%d\n",
+                    scenario.name, result.ticks, result.wallMs, result.ticks / (result.wallMs / 1000.0),
+                    result.entityUpdates, nsPerEntity, result.allocations, result.bytes, result.enemiesLeft);
+        std::fflush(stdout);
+    }
+    return 0;
+}
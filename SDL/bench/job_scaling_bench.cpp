@@ -0,0 +1,77 @@
+// job_scaling_bench.cpp
+// Enemy update time per tick on 1..N threads (N = hardware threads, or the
+// first argument), with the end state checked against the 1-thread run.
+// Prints CSV: threads, enemies, ms per tick, speedup over 1 thread, steals.
+
+#include "EnemyPool.h"
+#include "JobSystem.h"
+#include "Rng.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+namespace {
+
+// order-dependent sum, so any difference in any enemy shows
+double Checksum(const EnemyPool& pool) {
+    double sum = 0.0;
+    for (int i = 0; i < pool.Size(); i++) {
+        sum = sum * 1.000001 + pool.GetX(i) + pool.GetY(i) * 3.0;
+    }
+    return sum;
+}
+}
+
+int main(int argc, char* argv[]) {
+    int maxThreads = argc > 1 ? std::atoi(argv[1]) : (int)std::thread::hardware_concurrency();
+    if (maxThreads < 1) maxThreads = 1;
+    const int enemyCounts[] = {2000, 20000, 100000};
+    const int ticks = 60;
+    const int mapSize = 512;
+
+    TileMap map(mapSize, mapSize);
+    Rng rng(11);
+    for (int i = 0; i < mapSize * mapSize / 20; i++) {
+        map.SetTile(rng.NextInt(mapSize), rng.NextInt(mapSize), 1, 0);
+    }
+    TileCollisionView tiles{&map, TILE_SIZE};
+    float worldSize = (float)(mapSize * TILE_SIZE);
+
+    std::printf("threads,enemies,ms_per_tick,speedup,steals\n");
+    for (int count : enemyCounts) {
+        EnemyPool start;
+        start.Reserve(count);
+        for (int i = 0; i < count; i++) {
+            start.Add(Enemy(rng.NextFloat() * worldSize, rng.NextFloat() * worldSize, (Enemy::EnemyType)(i % 3), 1, 1.0f));
+        }
+
+        double singleMs = 0.0;
+        double singleChecksum = 0.0;
+        for (int threads = 1; threads <= maxThreads; threads++) {
+            JobSystem jobs;
+            jobs.Start(threads);
+            EnemyPool pool = start;
+            Enemy::UpdateContext context{1.0f / 120.0f, worldSize * 0.5f, worldSize * 0.5f, tiles, nullptr, &jobs};
+
+            auto begin = std::chrono::steady_clock::now();
+            for (int t = 0; t < ticks; t++) {
+                pool.Update(context);
+            }
+            auto end = std::chrono::steady_clock::now();
+            double ms = std::chrono::duration<double, std::milli>(end - begin).count() / ticks;
+
+            double checksum = Checksum(pool);
+            if (threads == 1) {
+                singleMs = ms;
+                singleChecksum = checksum;
+            } else if (checksum != singleChecksum) {
+                std::fprintf(stderr, "state mismatch at %d threads, %d enemies\n", threads, count);
+                return 1;
+            }
+            std::printf("%d,%d,%.4f,%.2f,%d\n", threads, count, ms, singleMs / ms, jobs.GetStealCount());
+        }
+    }
+    return 0;
+}
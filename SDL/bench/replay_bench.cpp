@@ -0,0 +1,51 @@
+// replay_bench.cpp
+// Runs a log from `fps --record FILE` through World with no window or frame
+// pacing. Prints one CSV row so runs of different builds can be diffed: the
+// hash must match exactly, ticks/s is the simulation throughput.
+
+#include "InputLog.h"
+#include "World.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: replay_bench FILE [repeats]\n");
+        return 2;
+    }
+    InputLog log;
+    if (!log.Load(argv[1])) {
+        std::fprintf(stderr, "could not load %s\n", argv[1]);
+        return 1;
+    }
+    int repeats = argc > 2 ? std::atoi(argv[2]) : 3;
+    if (repeats < 1) {
+        repeats = 1;
+    }
+
+    double bestMs = 1e30;
+    unsigned long long hash = 0;
+    bool stable = true;
+    for (int r = 0; r < repeats; r++) {
+        World world;
+        auto start = std::chrono::steady_clock::now();
+        log.RunHeadless(world);
+        auto end = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        if (ms < bestMs) bestMs = ms;
+        unsigned long long runHash = world.ComputeStateHash();
+        stable = stable && (r == 0 || runHash == hash);
+        hash = runHash;
+    }
+
+    int ticks = log.GetTickCount();
+    std::printf("ticks,best_ms,ticks_per_s,us_per_tick,state_hash\n");
+    std::printf("%d,%.3f,%.1f,%.3f,%016llx\n", ticks, bestMs, ticks / (bestMs / 1000.0), bestMs * 1000.0 / (ticks > 0 ? ticks : 1), hash);
+    if (!stable) {
+        std::fprintf(stderr, "state hash changed between repeats\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,109 @@
+// spatial_hash_bench.cpp
+// Bullet-vs-enemy hit testing: full scan against the SpatialHash path.
+// Density stays fixed while counts grow, so a sub-linear query shows up as a
+// flat per-bullet cost for the grid and a linearly growing one for the scan.
+
+#include "CombatSystem.h"
+#include "SpatialHash.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+
+struct Scenario {
+    std::vector<Enemy> enemies;
+    std::vector<Entity> bullets;
+};
+
+Scenario MakeScenario(int enemyCount, int bulletCount, unsigned seed) {
+    // roughly 16 tiles of floor per enemy, like a busy late level
+    float worldSize = std::sqrt((float)enemyCount * 16.0f) * TILE_SIZE;
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> position(0.0f, worldSize);
+
+    Scenario scenario;
+    scenario.enemies.reserve(enemyCount);
+    for (int i = 0; i < enemyCount; i++) {
+        scenario.enemies.emplace_back(position(rng), position(rng), Enemy::smartEnemy, 1, 1.0f);
+    }
+    scenario.bullets.reserve(bulletCount);
+    for (int i = 0; i < bulletCount; i++) {
+        scenario.bullets.push_back(Entity{position(rng), position(rng), 5.0f, 5.0f});
+    }
+    return scenario;
+}
+
+int ScanHits(const Scenario& scenario) {
+    int hits = 0;
+    for (const Entity& bullet : scenario.bullets) {
+        for (const Enemy& enemy : scenario.enemies) {
+            if (!enemy.IsDead() && CombatSystem::AABB(bullet, enemy.getBody())) {
+                hits++;
+                break;
+            }
+        }
+    }
+    return hits;
+}
+
+int GridHits(const Scenario& scenario, SpatialHash& grid) {
+    CombatSystem::BuildEnemyGrid(grid, scenario.enemies);
+    int hits = 0;
+    std::vector<int> nearby;
+    for (const Entity& bullet : scenario.bullets) {
+        nearby.clear();
+        grid.Query(bullet, nearby);
+        for (int index : nearby) {
+            const Enemy& enemy = scenario.enemies[index];
+            if (!enemy.IsDead() && CombatSystem::AABB(bullet, enemy.getBody())) {
+                hits++;
+                break;
+            }
+        }
+    }
+    return hits;
+}
+
+template <typename Fn>
+double BestMilliseconds(int repeats, Fn&& fn) {
+    double best = 1e30;
+    for (int r = 0; r < repeats; r++) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        if (ms < best) best = ms;
+    }
+    return best;
+}
+}
+
+int main() {
+    const int enemyCounts[] = {250, 500, 1000, 2000};
+    SpatialHash grid;
+
+    std::printf("%8s %8s %12s %12s %14s %14s %8s\n",
+        "enemies", "bullets", "scan ms", "grid ms", "scan ns/bullet", "grid ns/bullet", "speedup");
+    for (int enemyCount : enemyCounts) {
+        int bulletCount = enemyCount * 5; // 2k enemies -> 10k bullets
+        Scenario scenario = MakeScenario(enemyCount, bulletCount, 1234u);
+
+        int scanHits = 0;
+        int gridHits = 0;
+        double scanMs = BestMilliseconds(5, [&]() { scanHits = ScanHits(scenario); });
+        double gridMs = BestMilliseconds(5, [&]() { gridHits = GridHits(scenario, grid); });
+        if (scanHits != gridHits) {
+            std::fprintf(stderr, "hit mismatch at %d enemies: scan %d, grid %d\n", enemyCount, scanHits, gridHits);
+            return 1;
+        }
+
+        std::printf("%8d %8d %12.3f %12.3f %14.1f %14.1f %7.1fx\n",
+            enemyCount, bulletCount, scanMs, gridMs,
+            scanMs * 1e6 / bulletCount, gridMs * 1e6 / bulletCount, scanMs / gridMs);
+    }
+    return 0;
+}
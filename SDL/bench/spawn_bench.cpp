@@ -0,0 +1,98 @@
+// spawn_bench.cpp
+// Enemy spawn placement on a map that is 90% walls: the old loop of random
+// points retried until one misses the walls and the player, against drawing
+// from the FreeTileIndex. The retry loop is capped here so it cannot hang;
+// "failed" counts spawns that hit the cap.
+
+#include "Config.h"
+#include "FreeTileIndex.h"
+#include "Rng.h"
+#include "TileCollisionView.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+namespace {
+const int tileSize = 50;
+const int spawns = 1000;
+const float minDistance = 200.0f;
+const long long retryCap = 10000000;
+
+TileMap MakeDenseMap(int size, int wallPercent) {
+    Rng rng(7, 0);
+    TileMap map(size, size);
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            bool border = x == 0 || y == 0 || x == size - 1 || y == size - 1;
+            map.SetTile(x, y, (border || rng.NextInt(100) < wallPercent) ? 2 : 0, 0);
+        }
+    }
+    return map;
+}
+
+// SpawnSystem's previous placement loop
+bool RejectionSpawn(const TileCollisionView& tiles, int size, const Entity& player, Rng& rng, long long& tries) {
+    Entity temp;
+    temp.width = PLAYER_SIZE;
+    temp.height = PLAYER_SIZE;
+    for (long long attempt = 0; attempt < retryCap; attempt++) {
+        tries++;
+        float x = (float)rng.NextInt(size * tileSize);
+        float y = (float)rng.NextInt(size * tileSize);
+        float dx = x - player.x;
+        float dy = y - player.y;
+        if (!tiles.Collides(temp, x, y) && std::sqrt(dx * dx + dy * dy) >= minDistance) {
+            return true;
+        }
+    }
+    return false;
+}
+}
+
+int main() {
+    const int mapSizes[] = {64, 256, 1024, 4096};
+
+    std::printf("%6s %8s %10s %16s %14s %8s %16s %14s\n",
+                "map", "walls%", "free", "rejection ns/ea", "tries/spawn", "failed", "index ns/ea", "build ms");
+    for (int size : mapSizes) {
+        for (int wallPercent : {10, 90}) {
+            TileMap map = MakeDenseMap(size, wallPercent);
+            TileCollisionView tiles{&map, tileSize};
+            Entity player;
+            player.x = size * tileSize * 0.5f;
+            player.y = size * tileSize * 0.5f;
+
+            Rng rejectionRng(1, 0);
+            long long tries = 0;
+            int failed = 0;
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < spawns; i++) {
+                failed += RejectionSpawn(tiles, size, player, rejectionRng, tries) ? 0 : 1;
+            }
+            auto end = std::chrono::steady_clock::now();
+            double rejectionNs = std::chrono::duration<double, std::nano>(end - start).count() / spawns;
+
+            FreeTileIndex index;
+            start = std::chrono::steady_clock::now();
+            index.Build(map);
+            end = std::chrono::steady_clock::now();
+            double buildMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+            Rng indexRng(1, 0);
+            int picked = 0;
+            start = std::chrono::steady_clock::now();
+            for (int i = 0; i < spawns; i++) {
+                int x, y;
+                picked += index.Pick(indexRng, tileSize, player.x, player.y, minDistance, x, y) ? 1 : 0;
+            }
+            end = std::chrono::steady_clock::now();
+            double indexNs = std::chrono::duration<double, std::nano>(end - start).count() / spawns;
+
+            std::printf("%6d %8d %10d %16.1f %14.1f %8d %16.1f %14.3f\n",
+                        size, wallPercent, index.GetCount(), rejectionNs, (double)tries / spawns, failed,
+                        indexNs + picked * 0.0, buildMs);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,174 @@
+#include "AllocTracker.h"
+#include "Profiler.h"
+#include "SimRunner.h"
+#include "World.h"
+
+#include <iostream>
+#include <string>
+
+namespace {
+int failures = 0;
+
+void Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << std::endl;
+        failures++;
+    }
+}
+
+// Heap allocations a steady frame of play may make, every subsystem together
+const long long steadyFrameBudget = 0;
+
+// Calls to operator new itself; the optimizer may drop a new expression whose result goes unused
+void* Allocate() {
+    return ::operator new(sizeof(int));
+}
+
+void Free(void* pointer) {
+    ::operator delete(pointer);
+}
+
+void TestHooksCountNewAndDelete() {
+    AllocTracker& tracker = AllocTracker::Get();
+    Expect(tracker.IsInstalled(), "Linking AllocHooks.cpp should install the operator new hook");
+
+    long long total = tracker.GetTotalAllocations(AllocTracker::NEW);
+    long long live = tracker.GetLiveAllocations();
+    void* first = Allocate();
+    void* second = ::operator new[](16 * sizeof(int));
+    Expect(tracker.GetTotalAllocations(AllocTracker::NEW) == total + 2, "Each new should be counted once");
+    Expect(tracker.GetLiveAllocations() == live + 2, "Allocations should stay live until deleted");
+    Free(first);
+    ::operator delete[](second);
+    Expect(tracker.GetLiveAllocations() == live, "Each delete should be counted once");
+}
+
+void TestEndFrameKeepsPerFrameCounts() {
+    AllocTracker& tracker = AllocTracker::Get();
+    tracker.Reset();
+    void* values[5];
+    for (int i = 0; i < 4; i++) {
+        values[i] = Allocate();
+    }
+    tracker.EndFrame();
+    Expect(tracker.GetLastFrameAllocations() == 4, "A frame should count every allocation made in it");
+    Expect(tracker.GetStats(AllocTracker::otherSubsystem).peakFrame == 4, "The peak should follow the busiest frame");
+
+    values[4] = Allocate();
+    tracker.EndFrame();
+    AllocTracker::SubsystemStats other = tracker.GetStats(AllocTracker::otherSubsystem);
+    Expect(other.lastFrame == 1 && other.peakFrame == 4 && other.total == 5,
+           "Later frames should start from zero while the peak and total carry on");
+    Expect(tracker.GetFrameCount() == 2, "Every EndFrame should be counted");
+    for (void* value : values) {
+        Free(value);
+    }
+}
+
+#ifdef FPS_PROFILER_ENABLED
+void TestAllocationsLandInTheOpenSection() {
+    AllocTracker& tracker = AllocTracker::Get();
+    tracker.Reset();
+    void* values[4];
+    {
+        PROFILE_SCOPE("Test.Outer");
+        values[0] = Allocate();
+        {
+            PROFILE_SCOPE("Test.Inner");
+            values[1] = Allocate();
+        }
+        values[2] = Allocate();
+    }
+    values[3] = Allocate();
+    for (void* value : values) {
+        Free(value);
+    }
+
+    int outerSection = Profiler::Get().RegisterSection("Test.Outer");
+    int innerSection = Profiler::Get().RegisterSection("Test.Inner");
+    Expect(tracker.GetStats(outerSection).total == 2, "Allocations should go to the innermost open section");
+    Expect(tracker.GetStats(innerSection).total == 1, "A nested section should take its own allocations");
+    Expect(tracker.GetStats(AllocTracker::otherSubsystem).total == 1, "Allocations outside every section should go to other");
+    AllocTracker::SubsystemStats innerStats = tracker.GetStats(innerSection);
+    Expect(innerStats.name && std::string(innerStats.name) == "Test.Inner", "Subsystems should carry the section name");
+}
+#endif
+
+void ReportFrame(const AllocTracker& tracker) {
+    for (int i = 0; i < AllocTracker::subsystemCount; i++) {
+        AllocTracker::SubsystemStats stats = tracker.GetStats(i);
+        if (stats.lastFrame > 0) {
+            std::cerr << "  " << (stats.name ? stats.name : "?") << ": " << stats.lastFrame << " allocation(s)" << std::endl;
+        }
+    }
+}
+
+// Drives the world like Game's PLAYING state: live input each frame, ticks
+// inline at a fixed rate, the snapshot read back and its tile edits acknowledged
+void TestPlayingFramesStayInBudget() {
+    World world;
+    world.SetMapSize(40, 40);
+    world.SetSeed(7);
+    world.GenerateMap(400.0f, 300.0f);
+    world.SpawnEnemies(60, 1.0f);
+    world.GivePlayerWeapon(Weapon::MACHINEGUN);
+    world.SetPlayerInvulnerable(true);
+
+    SimRunner runner(world);
+    runner.SetTickRate(120.0f);
+    runner.Resume();
+    const float frameTime = 1.0f / 60.0f;
+    const int warmupFrames = 300;
+    const int measuredFrames = 600;
+
+    AllocTracker& tracker = AllocTracker::Get();
+    tracker.Reset();
+    long long worstFrame = 0;
+    int worstFrameIndex = -1;
+    for (int frame = 0; frame < warmupFrames + measuredFrames && runner.IsActive(); frame++) {
+        InputFrame input;
+        input.moveX = (frame / 50) % 2 == 0 ? 1.0f : -1.0f;
+        input.moveY = (frame / 35) % 2 == 0 ? 1.0f : -1.0f;
+        input.aimX = 200.0f + (float)(frame % 150) * 6.0f;
+        input.aimY = 100.0f + (float)(frame % 85) * 8.0f;
+        input.firePressed = true;
+        input.meleePressed = frame % 20 == 0;
+        input.reloadPressed = frame % 250 == 0;
+        runner.SetLiveInput(input);
+        runner.Advance(frameTime);
+
+        const FrameSnapshot& snapshot = runner.AcquireSnapshot();
+        if (!snapshot.tileEdits.empty()) {
+            runner.AcknowledgeTileEdits(snapshot.tileEdits.back().serial);
+        }
+        tracker.EndFrame();
+        if (frame >= warmupFrames && tracker.GetLastFrameAllocations() > worstFrame) {
+            worstFrame = tracker.GetLastFrameAllocations();
+            worstFrameIndex = frame;
+            ReportFrame(tracker);
+        }
+    }
+
+    Expect(runner.IsActive(), "The level should still be running after every measured frame");
+    Expect(worstFrame <= steadyFrameBudget, "Steady frames of play should stay within the allocation budget");
+    if (worstFrame > steadyFrameBudget) {
+        std::cerr << "  worst frame " << worstFrameIndex << " made " << worstFrame << " allocation(s)" << std::endl;
+    }
+}
+}
+
+int main() {
+    TestHooksCountNewAndDelete();
+    TestEndFrameKeepsPerFrameCounts();
+#ifdef FPS_PROFILER_ENABLED
+    TestAllocationsLandInTheOpenSection();
+#endif
+    TestPlayingFramesStayInBudget();
+    if (failures == 0) {
+        std::cout << "All allocation budget tests passed." << std::endl;
+        return 0;
+    }
+
+    std::cerr << failures << " test(s) failed." << std::endl;
+    return 1;
+}
@@ -0,0 +1,142 @@
+#include "AllocTracker.h"
+#include "Arena.h"
+#include "World.h"
+
+#include <cstdint>
+#include <iostream>
+
+namespace {
+int failures = 0;
+
+void Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << std::endl;
+        failures++;
+    }
+}
+
+void TestAllocationsAreAlignedAndBumped() {
+    Arena arena(256);
+    void* first = arena.Allocate(3, 1);
+    void* second = arena.Allocate(8, 64);
+    Expect(reinterpret_cast<std::uintptr_t>(first) % 16 == 0, "Allocations should be at least 16-byte aligned");
+    Expect(reinterpret_cast<std::uintptr_t>(second) % 64 == 0, "Allocations should honour a larger alignment");
+    Expect(second > first, "Later allocations should come after earlier ones");
+    Expect(arena.GetBlockCount() == 1, "Small allocations should share one block");
+}
+
+void TestResetReusesTheSameMemory() {
+    Arena arena(256);
+    void* first = arena.Allocate(100, 16);
+    arena.Reset();
+    Expect(arena.GetUsedBytes() == 0, "Reset should hand every byte back");
+    Expect(arena.Allocate(100, 16) == first, "After Reset the same bytes should be handed out again");
+    Expect(arena.GetHeapAllocationCount() == 1, "Reuse should not touch the heap");
+}
+
+void TestResetMergesOverflowBlocks() {
+    Arena arena(128);
+    for (int i = 0; i < 10; i++) {
+        arena.Allocate(100, 16);
+    }
+    Expect(arena.GetBlockCount() > 1, "Requests past the first block should open new ones");
+    arena.Reset();
+    Expect(arena.GetBlockCount() == 1, "Reset should fold the blocks into one");
+
+    long long before = arena.GetHeapAllocationCount();
+    for (int i = 0; i < 10; i++) {
+        arena.Allocate(100, 16);
+    }
+    Expect(arena.GetBlockCount() == 1 && arena.GetHeapAllocationCount() == before,
+           "The merged block should hold the same workload without growing");
+}
+
+void TestArenaVectorCopiesGoToTheHeap() {
+    Arena arena;
+    ArenaVector<int> values{ArenaAllocator<int>(&arena)};
+    values.reserve(8);
+    values.push_back(1);
+    values.push_back(2);
+
+    ArenaVector<int> copy = values;
+    Expect(copy.get_allocator().GetArena() == nullptr, "A copy should not share the source's arena");
+    Expect(copy.size() == 2 && copy[1] == 2, "A copy should keep the elements");
+
+    RebindArena(values, nullptr, 16);
+    Expect(values.get_allocator().GetArena() == nullptr && values.capacity() >= 16 && values[0] == 1,
+           "RebindArena should move the elements into the new storage");
+}
+
+void MakeWorld(World& world) {
+    world.SetMapSize(40, 40);
+    world.SetSeed(7);
+    world.GenerateMap(400.0f, 300.0f);
+    world.SpawnEnemies(40, 1.0f);
+    world.GivePlayerWeapon(Weapon::MACHINEGUN);
+    world.SetPlayerInvulnerable(true);
+}
+
+InputFrame MakeInput(int tick) {
+    InputFrame input;
+    input.moveX = (tick / 100) % 2 == 0 ? 1.0f : -1.0f;
+    input.moveY = (tick / 70) % 2 == 0 ? 1.0f : -1.0f;
+    input.aimX = 200.0f + (float)(tick % 300) * 3.0f;
+    input.aimY = 100.0f + (float)(tick % 170) * 4.0f;
+    input.firePressed = true;
+    input.meleePressed = tick % 40 == 0;
+    return input;
+}
+
+void TestSteadyTicksStayOffTheHeap() {
+    World world;
+    MakeWorld(world);
+    const float stepSize = 1.0f / 120.0f;
+    int tick = 0;
+    // warm up: the first bursts of fire and the first merges of the frame arena may grow storage
+    for (; tick < 600; tick++) {
+        world.Step(stepSize, MakeInput(tick));
+    }
+
+    long long before = AllocTracker::Get().GetTotalAllocations();
+    int ranTicks = 0;
+    World::Status status = World::RUNNING;
+    for (; tick < 1800 && status == World::RUNNING; tick++) {
+        status = world.Step(stepSize, MakeInput(tick));
+        ranTicks++;
+    }
+    Expect(ranTicks > 600, "The world should keep running through the measured ticks");
+    Expect(AllocTracker::Get().GetTotalAllocations() == before, "Steady ticks should not allocate from the heap");
+}
+
+void TestHealthItemsSurviveTheLevelArenaSwap() {
+    World world;
+    world.SetMapSize(24, 24);
+    world.SetSeed(3);
+    world.GenerateMap(400.0f, 300.0f);
+    world.StartNextLevel(1.0f);
+    size_t carried = world.GetHealthItems().size();
+    HealthItem first = world.GetHealthItems()[0];
+
+    world.StartNextLevel(1.0f);
+    const ArenaVector<HealthItem>& items = world.GetHealthItems();
+    Expect(items.size() > carried, "A new level should add health items to the ones left over");
+    Expect(items[0].x == first.x && items[0].y == first.y, "Left over health items should keep their place");
+    Expect(world.GetEnemies().Size() == 5 + world.GetLevel(), "The new level's enemies should be placed");
+}
+}
+
+int main() {
+    TestAllocationsAreAlignedAndBumped();
+    TestResetReusesTheSameMemory();
+    TestResetMergesOverflowBlocks();
+    TestArenaVectorCopiesGoToTheHeap();
+    TestSteadyTicksStayOffTheHeap();
+    TestHealthItemsSurviveTheLevelArenaSwap();
+    if (failures == 0) {
+        std::cout << "All arena tests passed." << std::endl;
+        return 0;
+    }
+
+    std::cerr << failures << " test(s) failed." << std::endl;
+    return 1;
+}
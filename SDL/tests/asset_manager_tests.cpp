@@ -0,0 +1,130 @@
+#include "AssetManager.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+int failures = 0;
+
+void Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << std::endl;
+        failures++;
+    }
+}
+
+// A scratch tree under the temp directory, removed again when the test ends
+struct TempTree {
+    std::filesystem::path root;
+
+    TempTree() {
+        root = std::filesystem::temp_directory_path() / "fps_asset_manager_tests";
+        std::filesystem::remove_all(root);
+        std::filesystem::create_directories(root);
+    }
+    ~TempTree() {
+        std::error_code error;
+        std::filesystem::remove_all(root, error);
+    }
+
+    std::string Dir(const char* name) const {
+        return (root / name).string() + "/";
+    }
+    void AddFile(const std::string& path) const {
+        std::filesystem::create_directories(std::filesystem::path(path).parent_path());
+        std::ofstream(path) << "x";
+    }
+};
+
+void TestFindRootTakesTheFirstDirectoryWithTheProbe() {
+    TempTree tree;
+    tree.AddFile(tree.Dir("second") + "sprites/sprite.png");
+    tree.AddFile(tree.Dir("third") + "sprites/sprite.png");
+    std::vector<std::string> candidates = {tree.Dir("first"), tree.Dir("second"), tree.Dir("third")};
+
+    std::string root;
+    Expect(AssetManager::FindRoot(candidates, "sprites/sprite.png", root), "A candidate holding the probe should be found");
+    Expect(root == tree.Dir("second"), "The earliest candidate holding the probe should win");
+
+    root = "unchanged";
+    Expect(!AssetManager::FindRoot(candidates, "sprites/missing.png", root), "A probe in no candidate should not be found");
+    Expect(root == "unchanged", "A failed search should leave the root alone");
+}
+
+void TestResolveJoinsTheRoot() {
+    AssetManager assets;
+    Expect(assets.Resolve("font.ttf") == "font.ttf", "Without a root paths should stay relative to the working directory");
+    assets.SetRoot("assets");
+    Expect(assets.GetRoot() == "assets/", "SetRoot should end the root with a separator");
+    Expect(assets.Resolve("sprites/heart.png") == "assets/sprites/heart.png", "Resolve should put the root in front");
+}
+
+void TestFontKeysSeparateSizes() {
+    Expect(AssetManager::FontKey("font.ttf", 14) != AssetManager::FontKey("font.ttf", 18),
+           "The same font at two sizes should be cached apart");
+    Expect(AssetManager::FontKey("font.ttf", 14) == AssetManager::FontKey("font.ttf", 14),
+           "The same font and size should share a key");
+}
+
+void TestMissingAssetsAreTimedAndNotCached() {
+    TempTree tree;
+    AssetManager assets;
+    assets.SetRoot(tree.Dir("empty"));
+    Expect(assets.LoadSurface("sprites/none.png") == nullptr, "A missing sprite should load as null");
+    Expect(assets.AcquireFont("none.ttf", 12) == nullptr, "A missing font should load as null");
+    Expect(assets.GetFontCount() == 0, "A font that failed to open should not be cached");
+
+    const std::vector<AssetManager::LoadRecord>& records = assets.GetLoadRecords();
+    Expect(records.size() == 2, "Every load attempt should be timed");
+    if (records.size() == 2) {
+        Expect(records[0].key == "sprites/none.png" && !records[0].loaded, "A sprite record should carry its path and failure");
+        Expect(records[1].key == AssetManager::FontKey("none.ttf", 12) && !records[1].loaded,
+               "A font record should carry its size");
+        Expect(records[0].milliseconds >= 0.0 && assets.GetTotalLoadMilliseconds() >= records[0].milliseconds,
+               "The total should cover every record");
+    }
+}
+
+void TestPackMissResolvesTheRootOnce() {
+    TempTree tree;
+    tree.AddFile(tree.Dir("SDL") + "sprites/sprite.png");
+    std::filesystem::create_directories(tree.root / "build");
+    std::filesystem::path previous = std::filesystem::current_path();
+    std::filesystem::current_path(tree.root / "build"); // the root is then ../SDL/
+
+    std::vector<AssetPack::Source> sources(1);
+    sources[0].name = "sprites/packed.png";
+    sources[0].bytes = {1, 2, 3};
+    AssetPack::Write("assets.pack", sources);
+    {
+        AssetManager assets;
+        Expect(assets.OpenPack("assets.pack"), "A pack in the working directory should open");
+        assets.ResolveRootOnMiss("sprites/sprite.png");
+        assets.LoadSurface("sprites/packed.png");
+        Expect(assets.GetRoot().empty(), "An asset found in the pack should not start the root search");
+        assets.LoadSurface("sprites/loose.png");
+        Expect(assets.GetRoot() == "../SDL/", "An asset missing from the pack should be looked for under the root");
+        const std::vector<AssetManager::LoadRecord>& records = assets.GetLoadRecords();
+        Expect(records.size() == 3 && records[1].packed && !records[2].packed, "Records should say where each asset came from");
+    }
+    std::filesystem::current_path(previous);
+}
+}
+
+int main() {
+    TestFindRootTakesTheFirstDirectoryWithTheProbe();
+    TestResolveJoinsTheRoot();
+    TestFontKeysSeparateSizes();
+    TestMissingAssetsAreTimedAndNotCached();
+    TestPackMissResolvesTheRootOnce();
+    if (failures == 0) {
+        std::cout << "All asset manager tests passed." << std::endl;
+        return 0;
+    }
+
+    std::cerr << failures << " test(s) failed." << std::endl;
+    return 1;
+}
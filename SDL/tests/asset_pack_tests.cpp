@@ -0,0 +1,119 @@
+#include "AssetPack.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace {
+int failures = 0;
+
+void Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << std::endl;
+        failures++;
+    }
+}
+
+std::vector<AssetPack::Source> MakeSources() {
+    AssetPack::Source font;
+    font.name = "font.ttf";
+    for (int i = 0; i < 37; i++) { // odd length, so the next entry needs padding
+        font.bytes.push_back((unsigned char)(i * 7));
+    }
+
+    AssetPack::Source sprite;
+    sprite.name = "sprites/heart.png";
+    sprite.format = AssetPack::RGBA32;
+    sprite.width = 3;
+    sprite.height = 2;
+    for (int i = 0; i < 3 * 2 * 4; i++) {
+        sprite.bytes.push_back((unsigned char)(255 - i));
+    }
+
+    AssetPack::Source empty;
+    empty.name = "empty.bin";
+    return {sprite, font, empty}; // out of order on purpose
+}
+
+bool SameBytes(const AssetPack::Entry* entry, const AssetPack::Source& source) {
+    return entry && entry->size == source.bytes.size()
+        && (source.bytes.empty() || std::memcmp(entry->data, source.bytes.data(), entry->size) == 0);
+}
+
+void TestWriteOpenRoundTrip() {
+    const char* path = "asset_pack_tests.pack";
+    std::vector<AssetPack::Source> sources = MakeSources();
+    Expect(AssetPack::Write(path, sources), "Write should succeed for a writable path");
+
+    AssetPack pack;
+    Expect(pack.Open(path), "Open should read back a written pack");
+    Expect(pack.IsOpen(), "An opened pack should say so");
+#ifndef _WIN32
+    Expect(pack.IsMapped(), "The pack should be memory-mapped where mmap exists");
+#endif
+    Expect(pack.GetEntryCount() == 3, "Every source should become an entry");
+    Expect(pack.GetEntryCount() == 3 && pack.GetEntry(0).name == "empty.bin" && pack.GetEntry(2).name == "sprites/heart.png",
+           "Entries should be sorted by name");
+
+    const AssetPack::Entry* sprite = pack.Find("sprites/heart.png");
+    Expect(SameBytes(sprite, sources[0]), "Pre-decoded pixels should round trip exactly");
+    Expect(sprite && sprite->format == AssetPack::RGBA32 && sprite->width == 3 && sprite->height == 2,
+           "A decoded entry should keep its format and size");
+    const AssetPack::Entry* font = pack.Find("font.ttf");
+    Expect(SameBytes(font, sources[1]), "Raw files should round trip exactly");
+    Expect(font && font->format == AssetPack::RAW, "A raw entry should stay raw");
+    Expect(SameBytes(pack.Find("empty.bin"), sources[2]), "An empty file should still get an entry");
+    Expect(pack.Find("sprites/missing.png") == nullptr, "An unknown name should not be found");
+    Expect(pack.Find("sprites") == nullptr, "A prefix of a name should not match it");
+
+    for (int i = 0; i < pack.GetEntryCount(); i++) {
+        const AssetPack::Entry& entry = pack.GetEntry(i);
+        Expect((std::uintptr_t)entry.data % AssetPack::dataAlignment == 0, "Entry data should start 16-byte aligned");
+    }
+
+    pack.Close();
+    Expect(!pack.IsOpen() && pack.GetEntryCount() == 0, "Close should drop the mapping and the index");
+    std::remove(path);
+}
+
+void TestOpenRejectsBadFiles() {
+    AssetPack pack;
+    Expect(!pack.Open("asset_pack_tests_missing.pack"), "Open should fail for a missing file");
+
+    const char* path = "asset_pack_tests_bad.pack";
+    FILE* file = std::fopen(path, "wb");
+    std::fputs("not an asset pack", file);
+    std::fclose(file);
+    Expect(!pack.Open(path), "Open should reject a file without the header");
+
+    AssetPack::Write(path, MakeSources());
+    // cut the file off in the middle of the data
+    file = std::fopen(path, "rb");
+    std::fseek(file, 0, SEEK_END);
+    long size = std::ftell(file);
+    std::fseek(file, 0, SEEK_SET);
+    std::vector<char> data(size);
+    std::fread(data.data(), 1, size, file);
+    std::fclose(file);
+    file = std::fopen(path, "wb");
+    std::fwrite(data.data(), 1, size - 8, file);
+    std::fclose(file);
+    Expect(!pack.Open(path), "Open should reject a pack whose entries run past the end");
+    Expect(!pack.IsOpen() && pack.GetEntryCount() == 0, "A failed open should leave the pack closed");
+    std::remove(path);
+}
+}
+
+int main() {
+    TestWriteOpenRoundTrip();
+    TestOpenRejectsBadFiles();
+    if (failures == 0) {
+        std::cout << "All asset pack tests passed." << std::endl;
+        return 0;
+    }
+
+    std::cerr << failures << " test(s) failed." << std::endl;
+    return 1;
+}
@@ -0,0 +1,102 @@
+#include "BulletPool.h"
+#include "Weapon.h"
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace {
+int failures = 0;
+
+void Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << std::endl;
+        failures++;
+    }
+}
+
+void ExpectNear(float actual, float expected, float tolerance, const char* message) {
+    if (std::fabs(actual - expected) > tolerance) {
+        std::cerr << "[FAIL] " << message << std::endl;
+        failures++;
+    }
+}
+
+void TestIntegrateMovesBullets() {
+    BulletPool pool;
+    pool.Add(10.0f, 20.0f, 1.0f, 0.0f, 400.0f, 5);
+    pool.Add(0.0f, 0.0f, 0.0f, -1.0f, 100.0f, 5);
+    pool.Integrate(0.5f);
+
+    ExpectNear(pool.GetX(0), 210.0f, 0.001f, "Bullet should move dx * speed * dt");
+    ExpectNear(pool.GetPrevX(0), 10.0f, 0.001f, "Previous position should be kept for interpolation");
+    ExpectNear(pool.GetY(1), -50.0f, 0.001f, "Bullet should move along negative y");
+}
+
+void TestKernelMatchesScalar() {
+    // 19 bullets covers full SIMD blocks plus a scalar tail
+    const int count = 19;
+    std::vector<float> x(count), y(count), prevX(count), prevY(count), dx(count), dy(count), speed(count);
+    for (int i = 0; i < count; i++) {
+        x[i] = i * 3.0f;
+        y[i] = i * -2.0f;
+        dx[i] = std::cos(i * 0.3f);
+        dy[i] = std::sin(i * 0.3f);
+        speed[i] = 300.0f + i * 10.0f;
+    }
+    std::vector<float> sx = x, sy = y, sprevX = prevX, sprevY = prevY;
+
+    BulletKernels::Integrate(x.data(), y.data(), prevX.data(), prevY.data(), dx.data(), dy.data(), speed.data(), count, 0.016f);
+    BulletKernels::IntegrateScalar(sx.data(), sy.data(), sprevX.data(), sprevY.data(), dx.data(), dy.data(), speed.data(), count, 0.016f);
+
+    bool same = true;
+    for (int i = 0; i < count; i++) {
+        same = same && std::fabs(x[i] - sx[i]) < 0.0001f && std::fabs(y[i] - sy[i]) < 0.0001f
+                    && prevX[i] == sprevX[i] && prevY[i] == sprevY[i];
+    }
+    Expect(same, "SIMD kernel should match the scalar kernel for every bullet");
+}
+
+void TestRemoveDeadSwapsAndPops() {
+    BulletPool pool;
+    for (int i = 0; i < 5; i++) {
+        pool.Add((float)i, 0.0f, 1.0f, 0.0f, 100.0f, i);
+    }
+    pool.Kill(1);
+    pool.Kill(4);
+    pool.Kill(1); // killing twice should not count twice
+    pool.RemoveDead();
+
+    Expect(pool.Size() == 3, "Dead bullets should be removed");
+    bool onlyAlive = true;
+    for (int i = 0; i < pool.Size(); i++) {
+        onlyAlive = onlyAlive && pool.IsAlive(i) && pool.GetDamage(i) != 1 && pool.GetDamage(i) != 4;
+    }
+    Expect(onlyAlive, "Remaining bullets should all be the live ones");
+    Expect(pool.GetDamage(1) == 3, "Last live bullet should be swapped into the first hole");
+}
+
+void TestWeaponFiresIntoPool() {
+    Weapon shotgun(Weapon::SHOTGUN);
+    BulletPool pool;
+    shotgun.Fire(0.0f, 0.0f, 100.0f, 0.0f, pool);
+
+    Expect(pool.Size() == 5, "Shotgun should add 5 pellets to the pool");
+    Expect(shotgun.GetCurrentAmmo() == shotgun.GetMagSize() - 1, "Shotgun should spend one shell per shot");
+    ExpectNear(pool.GetPrevX(0), 0.0f, 0.001f, "New bullets should start with prev at the muzzle");
+}
+}
+
+int main() {
+    TestIntegrateMovesBullets();
+    TestKernelMatchesScalar();
+    TestRemoveDeadSwapsAndPops();
+    TestWeaponFiresIntoPool();
+    if (failures == 0) {
+        std::cout << "All bullet pool tests passed." << std::endl;
+        return 0;
+    }
+
+    std::cerr << failures << " test(s) failed." << std::endl;
+    return 1;
+}
@@ -35,14 +35,10 @@ void TestVerticalEnemyMovement() {
 
     // simulate movement for 1 second
     float deltaTime = 1.0f;
-    Enemy::CollisionFunc collisionFunc = [](const Entity& entity, float nextX, float nextY) {
-        // simple collision function that treats the world bounds as walls
-        if (nextX < 0 || nextX + entity.width > 800 || nextY < 0 || nextY + entity.height > 600) {
-            return true; // collision with wall
-        }
-        return false; // no collision
-    };
-    Enemy::UpdateContext context{deltaTime, player.x, player.y, collisionFunc};
+    // open 800x600 floor, the world bounds act as walls
+    TileMap floor(16, 12);
+    TileCollisionView tiles{&floor, 50};
+    Enemy::UpdateContext context{deltaTime, player.x, player.y, tiles};
     enemies[0].Update(context);
 
     Expect(enemies[0].GetX() == 120.0f, "Vertical enemy should not move horizontally");
@@ -59,14 +55,10 @@ void TestHorizontalEnemyMovement() {
 
     // simulate movement for 1 second
     float deltaTime = 1.0f;
-    Enemy::CollisionFunc collisionFunc = [](const Entity& entity, float nextX, float nextY) {
-        // simple collision function that treats the world bounds as walls
-        if (nextX < 0 || nextX + entity.width > 800 || nextY < 0 || nextY + entity.height > 600) {
-            return true; // collision with wall
-        }
-        return false; // no collision
-    };
-    Enemy::UpdateContext context{deltaTime, player.x, player.y, collisionFunc};
+    // open 800x600 floor, the world bounds act as walls
+    TileMap floor(16, 12);
+    TileCollisionView tiles{&floor, 50};
+    Enemy::UpdateContext context{deltaTime, player.x, player.y, tiles};
     enemies[0].Update(context);
 
     Expect(enemies[0].GetX() != 120.0f, "Horizontal enemy should move horizontally");
@@ -148,7 +140,7 @@ void TestEnemyTakesDamageFromBullets() {
         0.2f, // move bullet enough to reach enemy
         bullets,
         enemies,
-        [](const Entity&, float, float) { return false; }, 
+        TileCollisionView{}, // no walls
         [](float, float, int) { /* no wall hit effect needed for this test */ }
     );
 
@@ -157,6 +149,75 @@ void TestEnemyTakesDamageFromBullets() {
     Expect(hpAfter == 0, "Pistol damage should kill this level-1 enemy in one hit");
 }
 
+void TestFastBulletDoesNotTunnelThroughEnemy() {
+    std::vector<Enemy> enemies;
+    enemies.push_back(Enemy(200.0f, 50.0f, Enemy::horizontalEnemy, 1, 1.0f));
+
+    // 500 px/s over a 1s step starts well before and ends well past the enemy
+    std::vector<Bullet> bullets;
+    bullets.push_back({0.0f, 60.0f, 1.0f, 0.0f, 500.0f, 100});
+
+    CombatSystem::UpdateBullets(
+        1.0f,
+        bullets,
+        enemies,
+        TileCollisionView{}, // no walls
+        [](float, float, int) {}
+    );
+
+    Expect(enemies[0].IsDead(), "Swept bullet should hit an enemy it passes through in one step");
+    Expect(bullets.empty(), "Bullet should be removed after hitting the enemy");
+}
+
+void TestFastBulletStopsAtWall() {
+    std::vector<Enemy> enemies;
+    enemies.push_back(Enemy(300.0f, 50.0f, Enemy::horizontalEnemy, 1, 1.0f));
+
+    // column of wall tiles at tileX == 2 sits between the bullet and the enemy
+    TileMap map(16, 16);
+    for (int y = 0; y < 16; y++) {
+        map.SetTile(2, y, 1, 0);
+    }
+    TileCollisionView wallAtColumnTwo{&map, TILE_SIZE};
+    std::vector<Bullet> bullets;
+    bullets.push_back({0.0f, 60.0f, 1.0f, 0.0f, 500.0f, 10});
+    int wallHits = 0;
+    float wallHitX = 0.0f;
+
+    CombatSystem::UpdateBullets(
+        1.0f,
+        bullets,
+        enemies,
+        wallAtColumnTwo,
+        [&](float x, float, int) { wallHits++; wallHitX = x; }
+    );
+
+    Expect(wallHits == 1, "Bullet should hit the wall it crosses during the step");
+    ExpectNear(wallHitX, 125.0f, 0.01f, "Wall hit should report the center of the first solid tile");
+    Expect(enemies[0].GetHP() == enemies[0].GetMaxHP(), "Enemy behind the wall should not be hit");
+    Expect(bullets.empty(), "Bullet should be removed after hitting the wall");
+}
+
+void TestSweepAndRaycastHelpers() {
+    float t = 0.0f;
+    Entity bullet{0.0f, 0.0f, 5.0f, 5.0f};
+    Entity target{50.0f, 0.0f, 10.0f, 10.0f};
+    Expect(CombatSystem::SweepAABB(bullet, 100.0f, 0.0f, target, t), "Sweep should find a target on the path");
+    ExpectNear(t, 0.45f, 0.001f, "Sweep should report first contact time");
+    Expect(!CombatSystem::SweepAABB(bullet, 40.0f, 0.0f, target, t), "Sweep should miss a target past the end of the move");
+
+    int tileX = 0;
+    int tileY = 0;
+    TileMap map(16, 16);
+    map.SetTile(3, 1, 2, 0);
+    TileCollisionView solidAtThreeOne{&map, 50};
+    Expect(CombatSystem::RaycastTiles(10.0f, 60.0f, 300.0f, 90.0f, solidAtThreeOne, t, tileX, tileY),
+        "Raycast should find the solid tile on the path");
+    Expect(tileX == 3 && tileY == 1, "Raycast should report the tile it hit");
+    Expect(!CombatSystem::RaycastTiles(10.0f, 10.0f, 300.0f, 10.0f, solidAtThreeOne, t, tileX, tileY),
+        "Raycast should miss tiles off the path");
+}
+
 // void TestGameOverScoreReset() {
 // }
 
@@ -178,7 +239,7 @@ void TestScoreIncrements() {
         enemies,
         player,
         playerMeleeDamage,
-        [](const Entity&, float, float) { return false; },
+        TileCollisionView{}, // no walls
         true,
         levelComplete
     );
@@ -203,6 +264,9 @@ int main() {
     TestEnemyDifficulty();
     TestEnemyTakesDamageFromBullets();
     TestScoreIncrements();
+    TestFastBulletDoesNotTunnelThroughEnemy();
+    TestFastBulletStopsAtWall();
+    TestSweepAndRaycastHelpers();
     if (failures == 0) {
         std::cout << "All enemy tests passed." << std::endl;
         return 0;
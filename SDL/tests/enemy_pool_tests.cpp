@@ -0,0 +1,134 @@
+#include "EnemyPool.h"
+#include "Enemy.h"
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace {
+int failures = 0;
+
+void Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << std::endl;
+        failures++;
+    }
+}
+
+bool GroupsHold(const EnemyPool& pool) {
+    for (int i = 0; i < pool.Size(); i++) {
+        Enemy::EnemyType type = pool.GetType(i);
+        if (i < pool.GetTypeBegin(type) || i >= pool.GetTypeEnd(type)) {
+            return false;
+        }
+    }
+    return pool.GetTypeEnd(Enemy::smartEnemy) == pool.Size();
+}
+
+void TestAddKeepsTypesGrouped() {
+    EnemyPool pool;
+    // interleaved types, added in the worst order for the groups
+    Enemy::EnemyType order[] = {Enemy::smartEnemy, Enemy::verticalEnemy, Enemy::horizontalEnemy,
+                                Enemy::smartEnemy, Enemy::horizontalEnemy, Enemy::verticalEnemy};
+    for (int i = 0; i < 6; i++) {
+        pool.Add(Enemy(i * 10.0f, 0.0f, order[i], 1, 1.0f));
+    }
+
+    Expect(pool.Size() == 6, "Every added enemy should be stored");
+    Expect(GroupsHold(pool), "Enemies should stay grouped horizontal, vertical, smart");
+    Expect(pool.GetTypeEnd(Enemy::horizontalEnemy) == 2, "Two horizontal enemies should come first");
+    Expect(pool.GetTypeBegin(Enemy::smartEnemy) == 4, "Smart enemies should come last");
+    float horizontalSum = pool.GetX(0) + pool.GetX(1);
+    float smartSum = pool.GetX(4) + pool.GetX(5);
+    Expect(horizontalSum == 60.0f, "The horizontal group should hold the two horizontal enemies");
+    Expect(smartSum == 30.0f, "The smart group should hold the two smart enemies");
+}
+
+void TestGetRoundTrips() {
+    Enemy enemy(75.0f, 125.0f, Enemy::verticalEnemy, 3, 1.2f);
+    enemy.TakeDamage(30);
+    EnemyPool pool;
+    pool.Add(enemy);
+    Enemy back = pool.Get(0);
+
+    Expect(back.character == Enemy::verticalEnemy, "Get should keep the type");
+    Expect(back.GetX() == 75.0f && back.GetY() == 125.0f, "Get should keep the position");
+    Expect(back.GetHP() == enemy.GetHP() && back.GetMaxHP() == enemy.GetMaxHP(), "Get should keep health");
+    Expect(back.GetSpeed() == enemy.GetSpeed(), "Get should keep speed");
+}
+
+void TestPoolUpdateMatchesEnemyUpdate() {
+    // open floor with a wall column, so some movers turn around
+    TileMap map(16, 12);
+    for (int y = 0; y < 12; y++) {
+        map.SetTile(8, y, 1, 0);
+    }
+    TileCollisionView tiles{&map, 50};
+
+    // added already grouped by type, so pool index i is enemies[i]
+    std::vector<Enemy> enemies;
+    for (int i = 0; i < 12; i++) {
+        enemies.push_back(Enemy(60.0f + i * 25.0f, 60.0f + (i % 4) * 90.0f, (Enemy::EnemyType)(i / 4), 1, 1.0f));
+    }
+    enemies[4].TakeDamage(1000); // one dying enemy holds still
+    EnemyPool pool;
+    for (const Enemy& enemy : enemies) {
+        pool.Add(enemy);
+    }
+
+    Enemy::UpdateContext context{0.05f, 200.0f, 250.0f, tiles};
+    for (int tick = 0; tick < 60; tick++) {
+        for (Enemy& enemy : enemies) {
+            enemy.Update(context);
+        }
+        pool.Update(context);
+    }
+
+    bool same = true;
+    for (int i = 0; i < pool.Size(); i++) {
+        const Enemy& enemy = enemies[i];
+        same = same && pool.GetType(i) == enemy.character && pool.GetX(i) == enemy.GetX() && pool.GetY(i) == enemy.GetY()
+                    && pool.IsDying(i) == enemy.IsDying() && pool.IsRemovable(i) == enemy.IsRemovable();
+    }
+    Expect(same, "Pool update should move every enemy exactly like Enemy::Update");
+}
+
+void TestRemoveFinishedKeepsGroups() {
+    EnemyPool pool;
+    for (int i = 0; i < 9; i++) {
+        pool.Add(Enemy(i * 10.0f, 0.0f, (Enemy::EnemyType)(i % 3), 1, 1.0f));
+    }
+    // kill the first horizontal and the last vertical enemy
+    pool.TakeDamage(0, 1000);
+    pool.TakeDamage(pool.GetTypeEnd(Enemy::verticalEnemy) - 1, 1000);
+    Expect(pool.IsDying(0) && pool.IsDead(0), "Lethal damage should start the death effect");
+
+    pool.RemoveFinished();
+    Expect(pool.Size() == 9, "Enemies still playing their death effect should stay");
+
+    TileCollisionView noTiles;
+    Enemy::UpdateContext context{Enemy::deathDuration, 0.0f, 0.0f, noTiles};
+    pool.Update(context);
+    pool.RemoveFinished();
+
+    Expect(pool.Size() == 7, "Enemies whose death effect has ended should be removed");
+    Expect(GroupsHold(pool), "Removal should keep the type groups together");
+    Expect(pool.GetTypeEnd(Enemy::horizontalEnemy) == 2, "One horizontal enemy should be gone");
+    Expect(pool.GetTypeEnd(Enemy::verticalEnemy) - pool.GetTypeBegin(Enemy::verticalEnemy) == 2, "One vertical enemy should be gone");
+    Expect(pool.GetPrevX(0) + pool.GetPrevX(1) == 90.0f, "The surviving horizontal enemies should be kept");
+}
+}
+
+int main() {
+    TestAddKeepsTypesGrouped();
+    TestGetRoundTrips();
+    TestPoolUpdateMatchesEnemyUpdate();
+    TestRemoveFinishedKeepsGroups();
+    if (failures == 0) {
+        std::cout << "All enemy pool tests passed." << std::endl;
+        return 0;
+    }
+
+    std::cerr << failures << " test(s) failed." << std::endl;
+    return 1;
+}
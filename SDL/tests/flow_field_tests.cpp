@@ -0,0 +1,110 @@
+#include "FlowField.h"
+#include "Enemy.h"
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace {
+int failures = 0;
+
+void Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << std::endl;
+        failures++;
+    }
+}
+
+// 10x8 room with a border, and a wall column at x == 4 from y = 1 to 3
+// so the only way from the left half to the right half is under it
+struct WalledRoom {
+    TileMap map;
+    TileCollisionView tiles;
+
+    WalledRoom() : map(10, 8) {
+        for (int y = 0; y < 8; y++) {
+            for (int x = 0; x < 10; x++) {
+                bool border = x == 0 || y == 0 || x == 9 || y == 7;
+                bool column = x == 4 && y >= 1 && y <= 3;
+                map.SetTile(x, y, (border || column) ? 1 : 0, 0);
+            }
+        }
+        tiles = TileCollisionView{&map, 50};
+    }
+};
+
+void TestDistancesGoAroundWalls() {
+    WalledRoom room;
+    FlowField field;
+    field.Build(room.tiles, 5, 2);
+
+    Expect(field.GetDistance(5, 2) == 0, "Goal tile should be at distance zero");
+    Expect(field.GetDistance(4, 2) == -1, "Wall tiles should be unreachable");
+    Expect(field.GetDistance(3, 2) == 6, "Path from behind the wall should go down and around it");
+}
+
+void TestSteerAvoidsWall() {
+    WalledRoom room;
+    FlowField field;
+    field.Build(room.tiles, 5, 2);
+
+    float dirX = 0.0f;
+    float dirY = 0.0f;
+    Expect(field.Steer(175.0f, 125.0f, dirX, dirY), "Open tile should have a direction");
+    Expect(dirY > 0.9f, "Chaser behind the wall should head down toward the gap");
+    Expect(!field.Steer(275.0f, 125.0f, dirX, dirY), "Goal tile should have no direction");
+}
+
+void TestWindowLimitsSearch() {
+    WalledRoom room;
+    FlowField field;
+    field.Build(room.tiles, 5, 2, 1);
+
+    Expect(field.GetDistance(6, 3) == 2, "Tiles inside the window should be reached");
+    Expect(field.GetDistance(8, 2) == -1, "Tiles outside the window should be left unreached");
+}
+
+void TestUnbuiltFieldHasNoDirection() {
+    FlowField field;
+    float dirX = 0.0f;
+    float dirY = 0.0f;
+    Expect(!field.Steer(10.0f, 10.0f, dirX, dirY), "Empty field should not steer");
+    Expect(field.GetDistance(0, 0) == -1, "Empty field should report unreachable");
+}
+
+float DistanceAfterChase(const WalledRoom& room, const FlowField* field) {
+    Enemy chaser(150.0f, 100.0f, Enemy::smartEnemy, 1, 1.0f);
+    Entity player{250.0f, 100.0f, 50.0f, 50.0f};
+    for (int i = 0; i < 250; i++) {
+        Enemy::UpdateContext context{0.02f, player.x, player.y, room.tiles, field};
+        chaser.Update(context);
+    }
+    float dx = chaser.GetX() - player.x;
+    float dy = chaser.GetY() - player.y;
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+void TestSmartEnemyFollowsField() {
+    WalledRoom room;
+    FlowField field;
+    field.Build(room.tiles, 5, 2);
+
+    Expect(DistanceAfterChase(room, nullptr) > 90.0f, "Straight-line chaser should stay stuck on the wall");
+    Expect(DistanceAfterChase(room, &field) < 10.0f, "Flow field chaser should reach the player around the wall");
+}
+}
+
+int main() {
+    TestDistancesGoAroundWalls();
+    TestSteerAvoidsWall();
+    TestWindowLimitsSearch();
+    TestUnbuiltFieldHasNoDirection();
+    TestSmartEnemyFollowsField();
+    if (failures == 0) {
+        std::cout << "All flow field tests passed." << std::endl;
+        return 0;
+    }
+
+    std::cerr << failures << " test(s) failed." << std::endl;
+    return 1;
+}
@@ -0,0 +1,165 @@
+#include "FreeTileIndex.h"
+#include "World.h"
+
+#include <cmath>
+#include <iostream>
+#include <set>
+
+namespace {
+int failures = 0;
+
+void Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << std::endl;
+        failures++;
+    }
+}
+
+// border walls plus a wall on every tile where (x + y) % 3 == 0
+TileMap MakeMap(int width, int height) {
+    TileMap map(width, height);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            bool border = x == 0 || y == 0 || x == width - 1 || y == height - 1;
+            map.SetTile(x, y, (border || (x + y) % 3 == 0) ? 2 : 0, 0);
+        }
+    }
+    return map;
+}
+
+void TestBuildListsEveryFreeTile() {
+    TileMap map = MakeMap(70, 40);
+    FreeTileIndex index;
+    index.Build(map);
+
+    int expected = 0;
+    bool matches = true;
+    for (int y = 0; y < 40; y++) {
+        for (int x = 0; x < 70; x++) {
+            bool free = !map.IsSolid(x, y);
+            expected += free ? 1 : 0;
+            matches = matches && index.Contains(x, y) == free;
+        }
+    }
+    Expect(index.GetCount() == expected, "The index should count every walkable tile");
+    Expect(matches, "Contains should agree with the map");
+
+    // Get walks the free tiles in row-major order
+    bool ordered = true;
+    int previous = -1;
+    for (int k = 0; k < index.GetCount(); k++) {
+        int x, y;
+        index.Get(k, x, y);
+        int linear = y * 70 + x;
+        ordered = ordered && linear > previous && !map.IsSolid(x, y);
+        previous = linear;
+    }
+    Expect(ordered, "Get should return each free tile once, in order");
+}
+
+void TestAddAndRemoveKeepCounts() {
+    TileMap map = MakeMap(40, 40);
+    FreeTileIndex index;
+    index.Build(map);
+    int before = index.GetCount();
+
+    index.Add(3, 3); // (3 + 3) % 3 == 0, a wall
+    Expect(index.Contains(3, 3) && index.GetCount() == before + 1, "Add should free a wall tile");
+    index.Add(3, 3);
+    Expect(index.GetCount() == before + 1, "Adding a free tile twice should not count it twice");
+    index.Remove(3, 3);
+    index.Remove(-1, 5);
+    Expect(!index.Contains(3, 3) && index.GetCount() == before, "Remove should take a tile back out");
+
+    int lastFree = -1;
+    for (int i = 0; i < 40 * 40; i++) {
+        if (!map.IsSolid(i % 40, i / 40)) {
+            lastFree = i;
+        }
+    }
+    int x, y;
+    index.Get(index.GetCount() - 1, x, y);
+    Expect(y * 40 + x == lastFree, "The last free tile should still be found after updates");
+}
+
+void TestPickRespectsWallsAndDistance() {
+    TileMap map = MakeMap(64, 64);
+    FreeTileIndex index;
+    index.Build(map);
+    Rng rng(3, 0);
+    const int tileSize = 50;
+    bool valid = true;
+    std::set<int> seen;
+    for (int i = 0; i < 2000; i++) {
+        int x, y;
+        if (!index.Pick(rng, tileSize, 1600.0f, 1600.0f, 400.0f, x, y)) {
+            valid = false;
+            break;
+        }
+        float dx = x * tileSize - 1600.0f;
+        float dy = y * tileSize - 1600.0f;
+        valid = valid && !map.IsSolid(x, y) && std::sqrt(dx * dx + dy * dy) >= 400.0f;
+        seen.insert(y * 64 + x);
+    }
+    Expect(valid, "Picked tiles should be free and far enough away");
+    Expect(seen.size() > 500, "Picks should spread over the free tiles");
+}
+
+void TestPickGivesUpWhenNothingQualifies() {
+    // a walled box with three free tiles, all next to the player
+    TileMap map(32, 32);
+    for (int y = 0; y < 32; y++) {
+        for (int x = 0; x < 32; x++) {
+            map.SetTile(x, y, 2, 0);
+        }
+    }
+    map.SetTile(10, 10, 0, 0);
+    map.SetTile(11, 10, 0, 0);
+    map.SetTile(10, 11, 0, 0);
+    FreeTileIndex index;
+    index.Build(map);
+    Rng rng(1, 0);
+
+    int x, y;
+    Expect(!index.Pick(rng, 50, 500.0f, 500.0f, 200.0f, x, y), "Pick should fail instead of looping when every free tile is too close");
+    Expect(index.Pick(rng, 50, 500.0f, 500.0f, 50.0f, x, y), "Pick should find the far tiles through the scan");
+    Expect((x == 11 && y == 10) || (x == 10 && y == 11), "The scan should only return qualifying tiles");
+
+    FreeTileIndex empty;
+    empty.Build(TileMap(0, 0));
+    Expect(!empty.Pick(rng, 50, 0.0f, 0.0f, 0.0f, x, y), "An empty index should have nothing to pick");
+}
+
+void TestWorldTracksBrokenWalls() {
+    World world(32, 32);
+    world.GenerateMap(400.0f, 300.0f);
+    int before = world.GetFreeTiles().GetCount();
+    // find a breakable wall and destroy it
+    for (int y = 1; y < 31; y++) {
+        for (int x = 1; x < 31; x++) {
+            if (world.GetTile(x, y) == 3) {
+                world.DamageTileAtWorld(x * 50.0f + 1.0f, y * 50.0f + 1.0f, 1000);
+                Expect(world.GetFreeTiles().Contains(x, y), "A broken wall should join the free tiles");
+                Expect(world.GetFreeTiles().GetCount() == before + 1, "Breaking one wall should free one tile");
+                return;
+            }
+        }
+    }
+    Expect(false, "The generated map should contain a breakable wall");
+}
+}
+
+int main() {
+    TestBuildListsEveryFreeTile();
+    TestAddAndRemoveKeepCounts();
+    TestPickRespectsWallsAndDistance();
+    TestPickGivesUpWhenNothingQualifies();
+    TestWorldTracksBrokenWalls();
+    if (failures == 0) {
+        std::cout << "All free tile index tests passed." << std::endl;
+        return 0;
+    }
+
+    std::cerr << failures << " test(s) failed." << std::endl;
+    return 1;
+}
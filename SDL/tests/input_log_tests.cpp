@@ -0,0 +1,166 @@
+#include "InputLog.h"
+#include "World.h"
+
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <vector>
+
+namespace {
+int failures = 0;
+
+void Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << std::endl;
+        failures++;
+    }
+}
+
+InputLog MakeSession(float firstLegX = 1.0f) {
+    InputLog::Header header;
+    header.seed = 99;
+    header.mapWidth = 24;
+    header.mapHeight = 24;
+    header.spawnX = 400.0f;
+    header.spawnY = 300.0f;
+    header.stepSize = 1.0f / 120.0f;
+    header.difficultyMultiplier = 1.0f;
+
+    InputLog log;
+    log.Begin(header);
+    // walk around in a square while firing at a moving point
+    for (int i = 0; i < 600; i++) {
+        InputFrame input;
+        int leg = (i / 60) % 4;
+        input.moveX = leg == 0 ? firstLegX : (leg == 2 ? -1.0f : 0.0f);
+        input.moveY = leg == 1 ? 1.0f : (leg == 3 ? -1.0f : 0.0f);
+        input.aimX = 400.0f + (float)(i % 200);
+        input.aimY = 100.0f + (float)(i % 50);
+        input.firePressed = (i % 3) == 0;
+        input.reloadPressed = i == 300;
+        input.meleePressed = (i % 50) == 0;
+        log.AddTick(input);
+    }
+    log.AddNextLevel(1.5f);
+    for (int i = 0; i < 120; i++) {
+        InputFrame input;
+        input.moveX = -1.0f;
+        input.aimX = 0.0f;
+        input.aimY = 0.0f;
+        input.firePressed = true;
+        log.AddTick(input);
+    }
+    return log;
+}
+
+void TestSaveLoadRoundTrip() {
+    InputLog log = MakeSession();
+    const char* path = "input_log_tests.fpsr";
+    Expect(log.Save(path), "Save should succeed for a writable path");
+
+    InputLog loaded;
+    Expect(loaded.Load(path), "Load should read back a saved log");
+    std::remove(path);
+
+    Expect(loaded.GetHeader().seed == 99, "The seed should survive a round trip");
+    Expect(loaded.GetHeader().mapWidth == 24 && loaded.GetHeader().mapHeight == 24, "The map size should survive a round trip");
+    Expect(loaded.GetHeader().stepSize == log.GetHeader().stepSize, "The step size should be stored exactly");
+    Expect(loaded.GetEntryCount() == log.GetEntryCount(), "Every entry should be read back");
+    Expect(loaded.GetTickCount() == 720, "Only input entries count as ticks");
+
+    bool same = loaded.GetEntryCount() == log.GetEntryCount();
+    for (int i = 0; same && i < log.GetEntryCount(); i++) {
+        const InputLog::Entry& a = log.GetEntry(i);
+        const InputLog::Entry& b = loaded.GetEntry(i);
+        same = a.kind == b.kind
+            && a.input.moveX == b.input.moveX && a.input.moveY == b.input.moveY
+            && a.input.aimX == b.input.aimX && a.input.aimY == b.input.aimY
+            && a.input.firePressed == b.input.firePressed
+            && a.input.meleePressed == b.input.meleePressed
+            && a.input.reloadPressed == b.input.reloadPressed
+            && a.input.selectWeaponSlot == b.input.selectWeaponSlot;
+        if (a.kind != InputLog::TICK) {
+            same = same && a.difficultyMultiplier == b.difficultyMultiplier;
+        }
+    }
+    Expect(same, "Digital input should round trip exactly");
+}
+
+void TestReplayIsDeterministic() {
+    InputLog log = MakeSession();
+    World first;
+    World second(64, 64); // starting size is replaced by the header
+    first.SetSeed(1);
+    Expect(log.RunHeadless(first) == 720, "RunHeadless should report the ticks it ran");
+    log.RunHeadless(second);
+    Expect(first.GetLevel() == 2, "The logged level change should be replayed");
+    Expect(first.ComputeStateHash() == second.ComputeStateHash(), "Two replays of one log should end in the same state");
+
+    InputLog changed = MakeSession(0.0f);
+    World third;
+    changed.RunHeadless(third);
+    Expect(third.ComputeStateHash() != first.ComputeStateHash(), "A different input stream should change the state hash");
+}
+
+void TestLoadRejectsBadFiles() {
+    InputLog log;
+    Expect(!log.Load("input_log_tests_missing.fpsr"), "Load should fail for a missing file");
+
+    const char* path = "input_log_tests_bad.fpsr";
+    FILE* file = std::fopen(path, "wb");
+    std::fputs("not a replay", file);
+    std::fclose(file);
+    Expect(!log.Load(path), "Load should reject a file without the header");
+
+    MakeSession().Save(path);
+    // cut the file off in the middle of the entries
+    file = std::fopen(path, "rb");
+    std::fseek(file, 0, SEEK_END);
+    long size = std::ftell(file);
+    std::fseek(file, 0, SEEK_SET);
+    std::vector<char> data(size);
+    std::fread(data.data(), 1, size, file);
+    std::fclose(file);
+    file = std::fopen(path, "wb");
+    std::fwrite(data.data(), 1, size / 2, file);
+    std::fclose(file);
+    Expect(!log.Load(path), "Load should reject a truncated log");
+    Expect(log.GetEntryCount() == 0, "A failed load should leave the log empty");
+
+    InputLog::Header header = MakeSession().GetHeader();
+    const float badSteps[] = {0.0f, -1.0f / 120.0f, std::nanf(""), INFINITY};
+    for (float stepSize : badSteps) {
+        InputLog badStep;
+        header.stepSize = stepSize;
+        badStep.Begin(header);
+        badStep.AddTick(InputFrame());
+        badStep.Save(path);
+        Expect(!log.Load(path), "Load should reject a step size that isn't finite and positive");
+    }
+    header.stepSize = 1.0f / 120.0f;
+    const int badSizes[][2] = {{0, 24}, {24, -3}, {1, 24}, {24, 2}, {MAX_MAP_SIZE + 1, 24}};
+    for (const int* size : badSizes) {
+        InputLog badMap;
+        header.mapWidth = size[0];
+        header.mapHeight = size[1];
+        badMap.Begin(header);
+        badMap.Save(path);
+        Expect(!log.Load(path), "Load should reject a map size the world can't be built at");
+    }
+    Expect(log.GetEntryCount() == 0, "A rejected header should leave the log empty");
+    std::remove(path);
+}
+}
+
+int main() {
+    TestSaveLoadRoundTrip();
+    TestReplayIsDeterministic();
+    TestLoadRejectsBadFiles();
+    if (failures == 0) {
+        std::cout << "All input log tests passed." << std::endl;
+        return 0;
+    }
+
+    std::cerr << failures << " test(s) failed." << std::endl;
+    return 1;
+}
@@ -0,0 +1,143 @@
+#include "JobSystem.h"
+#include "EnemyPool.h"
+#include "World.h"
+#include "Rng.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace {
+int failures = 0;
+
+void Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << std::endl;
+        failures++;
+    }
+}
+
+void TestEveryIndexRunsOnce() {
+    const int threadCounts[] = {1, 2, 3, 4};
+    for (int threads : threadCounts) {
+        JobSystem jobs;
+        jobs.Start(threads);
+        Expect(jobs.GetThreadCount() == threads, "Start should use the requested thread count");
+        // 1001 items in ranges of 64 leaves a short last range
+        std::vector<std::atomic<int>> hits(1001);
+        for (int pass = 0; pass < 3; pass++) {
+            jobs.ParallelFor((int)hits.size(), 64, [&](int begin, int end) {
+                for (int i = begin; i < end; i++) {
+                    hits[i]++;
+                }
+            });
+        }
+        bool once = true;
+        for (auto& hit : hits) {
+            once = once && hit.load() == 3;
+        }
+        Expect(once, "ParallelFor should run every index exactly once per call");
+    }
+}
+
+void TestIdleThreadStealsWork() {
+    JobSystem jobs;
+    jobs.Start(2);
+    // The caller is dealt ranges 0-3 and pops 3 first. It holds range 3 until
+    // range 0 has run, which only the worker can do by stealing it.
+    std::atomic<bool> firstRangeRan(false);
+    jobs.ParallelFor(8, 1, [&](int begin, int) {
+        if (begin == 0) {
+            firstRangeRan = true;
+        }
+        if (begin == 3) {
+            auto giveUp = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (!firstRangeRan && std::chrono::steady_clock::now() < giveUp) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    Expect(firstRangeRan, "Every range should run");
+    Expect(jobs.GetStealCount() > 0, "A thread out of work should steal from another's deque");
+}
+
+void TestParallelEnemyUpdateMatchesSerial() {
+    const int mapSize = 64;
+    TileMap map(mapSize, mapSize);
+    Rng rng(3);
+    for (int i = 0; i < mapSize * mapSize / 10; i++) {
+        map.SetTile(rng.NextInt(mapSize), rng.NextInt(mapSize), 1, 0);
+    }
+    TileCollisionView tiles{&map, TILE_SIZE};
+    float worldSize = (float)(mapSize * TILE_SIZE);
+
+    EnemyPool serial;
+    for (int i = 0; i < 3000; i++) {
+        Enemy enemy(rng.NextFloat() * worldSize, rng.NextFloat() * worldSize, (Enemy::EnemyType)rng.NextInt(3), 1, 1.0f);
+        if (i % 50 == 0) {
+            enemy.TakeDamage(1000);
+        }
+        serial.Add(enemy);
+    }
+    EnemyPool parallel = serial;
+
+    JobSystem jobs;
+    jobs.Start(4);
+    Enemy::UpdateContext serialContext{1.0f / 120.0f, worldSize * 0.5f, worldSize * 0.5f, tiles};
+    Enemy::UpdateContext parallelContext{1.0f / 120.0f, worldSize * 0.5f, worldSize * 0.5f, tiles, nullptr, &jobs};
+    for (int tick = 0; tick < 100; tick++) {
+        serial.Update(serialContext);
+        parallel.Update(parallelContext);
+    }
+
+    bool same = parallel.Size() == serial.Size();
+    for (int i = 0; same && i < serial.Size(); i++) {
+        same = parallel.GetX(i) == serial.GetX(i) && parallel.GetY(i) == serial.GetY(i)
+            && parallel.GetPrevX(i) == serial.GetPrevX(i) && parallel.IsRemovable(i) == serial.IsRemovable(i);
+    }
+    Expect(same, "Updating enemies over four threads should match the single-threaded update exactly");
+}
+
+std::uint64_t RunScriptedWorld(JobSystem* jobs) {
+    World world(40, 40);
+    world.SetSeed(77);
+    world.GenerateMap(1000.0f, 1000.0f);
+    world.SetJobSystem(jobs);
+    for (int i = 0; i < 600; i++) {
+        world.AddEnemy(100.0f + (i % 30) * 60.0f, 100.0f + (i / 30) * 90.0f, (Enemy::EnemyType)(i % 3), 1.0f);
+    }
+    world.GivePlayerWeapon(Weapon::MACHINEGUN);
+    for (int tick = 0; tick < 600; tick++) {
+        InputFrame input;
+        input.aimX = 1000.0f + (tick % 100) * 10.0f;
+        input.aimY = 200.0f;
+        input.firePressed = true;
+        input.meleePressed = tick % 30 == 0;
+        world.Step(1.0f / 120.0f, input);
+    }
+    return world.ComputeStateHash();
+}
+
+void TestWorldIsDeterministicAcrossThreadCounts() {
+    std::uint64_t single = RunScriptedWorld(nullptr);
+    JobSystem jobs;
+    jobs.Start(3);
+    Expect(RunScriptedWorld(&jobs) == single, "A world stepped with worker threads should end in the same state");
+}
+}
+
+int main() {
+    TestEveryIndexRunsOnce();
+    TestIdleThreadStealsWork();
+    TestParallelEnemyUpdateMatchesSerial();
+    TestWorldIsDeterministicAcrossThreadCounts();
+    if (failures == 0) {
+        std::cout << "All job system tests passed." << std::endl;
+        return 0;
+    }
+
+    std::cerr << failures << " test(s) failed." << std::endl;
+    return 1;
+}
@@ -44,7 +44,7 @@ void testPlayerCollisionWithEnemy() {
         playerInvulnTimer,
         playerSpeed,
         playerHP,
-        [](const Entity&, float, float) { return false; }
+        TileCollisionView{} // no walls
     );
 
     Expect(playerHP == 90, "Player should lose 10 HP on enemy collision");
@@ -59,7 +59,7 @@ void testPlayerCollisionWithEnemy() {
         playerInvulnTimer,
         playerSpeed,
         playerHP,
-        [](const Entity&, float, float) { return false; }
+        TileCollisionView{} // no walls
     );
 
     Expect(playerHP == 90, "Player should not take damage while invulnerable");
@@ -76,7 +76,7 @@ void testPlayerCollisionWithEnemy() {
         playerInvulnTimer,
         playerSpeed,
         playerHP,
-        [](const Entity&, float, float) { return false; }
+        TileCollisionView{} // no walls
      );
     Expect(playerHP == 80, "Player should take damage again after invulnerability expires");
     Expect(playerInvulnTimer > 0.0f, "Player invulnerability should restart after taking damage again");
@@ -0,0 +1,146 @@
+#include "Profiler.h"
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace {
+int failures = 0;
+
+void Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << std::endl;
+        failures++;
+    }
+}
+
+void ExpectNear(double actual, double expected, double tolerance, const char* message) {
+    if (std::fabs(actual - expected) > tolerance) {
+        std::cerr << "[FAIL] " << message << " (got " << actual << ", expected " << expected << ")" << std::endl;
+        failures++;
+    }
+}
+
+void TestRegisterSectionReusesNames() {
+    Profiler& profiler = Profiler::Get();
+    int first = profiler.RegisterSection("Test.Register");
+    int second = profiler.RegisterSection("Test.Register");
+    int other = profiler.RegisterSection("Test.Other");
+    Expect(first == second, "Registering the same name twice should return the same section");
+    Expect(first != other, "Different names should get different sections");
+}
+
+void TestHitsInOneFrameAreSummed() {
+    Profiler& profiler = Profiler::Get();
+    profiler.Reset();
+    int section = profiler.RegisterSection("Test.Sum");
+    profiler.AddTime(section, 1.0);
+    profiler.AddTime(section, 2.5);
+    profiler.EndFrame();
+
+    Profiler::SectionStats stats = profiler.GetStats(section);
+    Expect(stats.samples == 1, "Several hits in one frame should make one sample");
+    ExpectNear(stats.avgMs, 3.5, 1e-9, "The frame sample should be the sum of its hits");
+}
+
+void TestStatsOverWindow() {
+    Profiler& profiler = Profiler::Get();
+    profiler.Reset();
+    int section = profiler.RegisterSection("Test.Stats");
+    // 1..100 ms, one per frame
+    for (int i = 1; i <= 100; i++) {
+        profiler.AddTime(section, (double)i);
+        profiler.EndFrame();
+    }
+    // frames that skip the section add no sample
+    profiler.EndFrame();
+
+    Profiler::SectionStats stats = profiler.GetStats(section);
+    Expect(stats.samples == 100, "Each frame that hit the section should add one sample");
+    ExpectNear(stats.minMs, 1.0, 1e-9, "Min should be the smallest frame");
+    ExpectNear(stats.maxMs, 100.0, 1e-9, "Max should be the largest frame");
+    ExpectNear(stats.avgMs, 50.5, 1e-9, "Avg should be the mean frame");
+    ExpectNear(stats.p99Ms, 99.0, 1e-9, "P99 should use the nearest rank");
+}
+
+void TestWindowDropsOldFrames() {
+    Profiler& profiler = Profiler::Get();
+    profiler.Reset();
+    int section = profiler.RegisterSection("Test.Window");
+    for (int i = 0; i < Profiler::windowSize; i++) {
+        profiler.AddTime(section, 100.0);
+        profiler.EndFrame();
+    }
+    for (int i = 0; i < Profiler::windowSize; i++) {
+        profiler.AddTime(section, 1.0);
+        profiler.EndFrame();
+    }
+
+    Profiler::SectionStats stats = profiler.GetStats(section);
+    Expect(stats.samples == Profiler::windowSize, "The window should hold at most windowSize frames");
+    ExpectNear(stats.maxMs, 1.0, 1e-9, "Frames older than the window should be forgotten");
+}
+
+void TestScopeRecordsTime() {
+    Profiler& profiler = Profiler::Get();
+    profiler.Reset();
+    {
+        PROFILE_SCOPE("Test.Scope");
+    }
+    profiler.EndFrame();
+
+    int section = profiler.RegisterSection("Test.Scope");
+#ifdef FPS_PROFILER_ENABLED
+    Expect(profiler.GetStats(section).samples == 1, "PROFILE_SCOPE should record one sample when enabled");
+#else
+    Expect(profiler.GetStats(section).samples == 0, "PROFILE_SCOPE should compile away when disabled");
+#endif
+}
+
+void TestCsvHasOneRowPerSection() {
+    Profiler& profiler = Profiler::Get();
+    profiler.Reset();
+    int section = profiler.RegisterSection("Test.Csv");
+    profiler.AddTime(section, 2.0);
+    profiler.EndFrame();
+
+    const char* path = "profiler_tests.csv";
+    Expect(profiler.WriteCsv(path), "WriteCsv should succeed for a writable path");
+
+    std::ifstream file(path);
+    std::string header;
+    std::getline(file, header);
+    Expect(header == "section,frames,min_ms,avg_ms,p99_ms,max_ms", "CSV should start with the column header");
+    int rows = 0;
+    bool foundSection = false;
+    std::string line;
+    while (std::getline(file, line)) {
+        rows++;
+        if (line.rfind("Test.Csv,1,", 0) == 0) {
+            foundSection = true;
+        }
+    }
+    file.close();
+    std::remove(path);
+    Expect(rows == profiler.GetSectionCount(), "CSV should have one row per section");
+    Expect(foundSection, "CSV should include the section's frame count");
+}
+}
+
+int main() {
+    TestRegisterSectionReusesNames();
+    TestHitsInOneFrameAreSummed();
+    TestStatsOverWindow();
+    TestWindowDropsOldFrames();
+    TestScopeRecordsTime();
+    TestCsvHasOneRowPerSection();
+    if (failures == 0) {
+        std::cout << "All profiler tests passed." << std::endl;
+        return 0;
+    }
+
+    std::cerr << failures << " test(s) failed." << std::endl;
+    return 1;
+}
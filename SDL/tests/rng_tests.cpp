@@ -0,0 +1,87 @@
+#include "Rng.h"
+
+#include <cstdint>
+#include <iostream>
+
+namespace {
+int failures = 0;
+
+void Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << std::endl;
+        failures++;
+    }
+}
+
+void TestMatchesReferenceSequence() {
+    // first outputs of the PCG32 reference demo (seed 42, stream 54)
+    Rng rng(42, 54);
+    const std::uint32_t expected[] = {0xa15c02b7, 0x7b47f409, 0xba1d3330, 0x83d2f293, 0xbfa4784b, 0xcbed606e};
+    bool matches = true;
+    for (std::uint32_t value : expected) {
+        matches = matches && rng.Next() == value;
+    }
+    Expect(matches, "Rng should produce the reference PCG32 sequence");
+}
+
+void TestSameSeedRepeats() {
+    Rng first(7, 1);
+    Rng second(7, 1);
+    bool same = true;
+    for (int i = 0; i < 1000; i++) {
+        same = same && first.Next() == second.Next();
+    }
+    Expect(same, "The same seed and stream should repeat the sequence");
+
+    first.Seed(7, 1);
+    second.Seed(7, 2);
+    int equal = 0;
+    for (int i = 0; i < 1000; i++) {
+        equal += first.Next() == second.Next() ? 1 : 0;
+    }
+    Expect(equal < 5, "Different streams of one seed should not track each other");
+}
+
+void TestNextIntStaysInRange() {
+    Rng rng(99, 3);
+    int counts[3] = {0, 0, 0};
+    bool inRange = true;
+    for (int i = 0; i < 30000; i++) {
+        int value = rng.NextInt(3);
+        if (value < 0 || value >= 3) {
+            inRange = false;
+            continue;
+        }
+        counts[value]++;
+    }
+    Expect(inRange, "NextInt should stay in [0, bound)");
+    for (int count : counts) {
+        Expect(count > 9000 && count < 11000, "NextInt should be roughly uniform");
+    }
+    Expect(rng.NextInt(0) == 0 && rng.NextInt(-5) == 0, "NextInt should return 0 for an empty range");
+}
+
+void TestNextFloatStaysInRange() {
+    Rng rng(5, 5);
+    bool inRange = true;
+    for (int i = 0; i < 10000; i++) {
+        float value = rng.NextFloat();
+        inRange = inRange && value >= 0.0f && value < 1.0f;
+    }
+    Expect(inRange, "NextFloat should stay in [0, 1)");
+}
+}
+
+int main() {
+    TestMatchesReferenceSequence();
+    TestSameSeedRepeats();
+    TestNextIntStaysInRange();
+    TestNextFloatStaysInRange();
+    if (failures == 0) {
+        std::cout << "All rng tests passed." << std::endl;
+        return 0;
+    }
+
+    std::cerr << failures << " test(s) failed." << std::endl;
+    return 1;
+}
@@ -0,0 +1,282 @@
+#include "SimRunner.h"
+#include "TripleBuffer.h"
+#include "InputLog.h"
+#include "World.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+namespace {
+int failures = 0;
+
+void Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << std::endl;
+        failures++;
+    }
+}
+
+// a power-of-two tick rate keeps the step and its multiples exact in float
+const float tickRate = 64.0f;
+const float stepSize = 1.0f / tickRate;
+
+void MakeWorld(World& world) {
+    world.SetMapSize(24, 24);
+    world.SetSeed(5);
+    world.GenerateMap(400.0f, 300.0f);
+    world.SpawnEnemies(5, 1.0f);
+    world.SetPlayerInvulnerable(true);
+}
+
+// Waits up to a few seconds for condition, for tests with a running sim thread
+template <typename Condition>
+bool WaitFor(Condition condition) {
+    auto giveUp = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() > giveUp) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+void TestTripleBufferHandsOverWholeValues() {
+    struct Pair {
+        int a = 0;
+        int b = 0;
+    };
+    TripleBuffer<Pair> buffer;
+    const int last = 20000;
+    std::thread writer([&]() {
+        for (int i = 1; i <= last; i++) {
+            Pair& pair = buffer.Back();
+            pair.a = i;
+            pair.b = i;
+            buffer.Publish();
+        }
+    });
+
+    bool whole = true;
+    bool ordered = true;
+    int seen = 0;
+    auto giveUp = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (seen < last && std::chrono::steady_clock::now() < giveUp) {
+        const Pair& pair = buffer.Acquire();
+        whole = whole && pair.a == pair.b;
+        ordered = ordered && pair.a >= seen;
+        seen = pair.a;
+    }
+    writer.join();
+
+    Expect(whole, "Acquire should never see a value the writer is still filling");
+    Expect(ordered, "Acquire should never go back to an older value");
+    Expect(seen == last, "The last published value should reach the reader");
+}
+
+void TestAdvanceRunsFixedTicksAndPublishes() {
+    World world;
+    MakeWorld(world);
+    SimRunner runner(world);
+    runner.SetTickRate(tickRate);
+
+    runner.Advance(stepSize * 3.0f);
+    Expect(runner.AcquireSnapshot().tick == 0, "A parked runner should not tick");
+
+    runner.Resume();
+    for (int frame = 0; frame < 10; frame++) {
+        runner.Advance(stepSize * 3.0f);
+    }
+    const FrameSnapshot& snapshot = runner.AcquireSnapshot();
+    Expect(snapshot.tick == 30, "Each Advance should run the ticks its time covers");
+    Expect(snapshot.player.x == world.GetPlayer().x && snapshot.player.y == world.GetPlayer().y,
+           "The snapshot should hold the player as the last tick left it");
+    Expect(snapshot.enemies.Size() == world.GetEnemies().Size(), "The snapshot should hold every enemy");
+    Expect(snapshot.levelTimer == world.GetLevelTimer() && snapshot.score == world.GetScore(),
+           "The snapshot should carry the HUD values");
+}
+
+void TestLiveInputEdgesReachOneTick() {
+    World world;
+    MakeWorld(world);
+    SimRunner runner(world);
+    runner.SetTickRate(tickRate);
+    InputLog log;
+    InputLog::Header header;
+    header.stepSize = stepSize;
+    log.Begin(header);
+    runner.SetRecordLog(&log);
+    runner.Resume();
+
+    InputFrame tap;
+    tap.moveX = 1.0f;
+    tap.reloadPressed = true;
+    tap.selectWeaponSlot = 0;
+    runner.SetLiveInput(tap);
+    InputFrame hold;
+    hold.moveX = 1.0f;
+    runner.SetLiveInput(hold); // the key came back up before any tick ran
+    runner.Advance(stepSize * 2.0f);
+
+    Expect(log.GetTickCount() == 2, "Both ticks should be recorded");
+    if (log.GetTickCount() == 2) {
+        const InputFrame& first = log.GetEntry(0).input;
+        const InputFrame& second = log.GetEntry(1).input;
+        Expect(first.reloadPressed && first.selectWeaponSlot == 0, "A tap between ticks should reach the next tick");
+        Expect(!second.reloadPressed && second.selectWeaponSlot == -1, "A tap should reach only one tick");
+        Expect(first.moveX == 1.0f && second.moveX == 1.0f, "Held input should reach every tick");
+    }
+}
+
+void TestRunnerParksWhenTheLevelEnds() {
+    World world;
+    world.SetMapSize(24, 24);
+    world.GenerateMap(400.0f, 300.0f); // no enemies, so the first tick completes the level
+    SimRunner runner(world);
+    runner.SetTickRate(tickRate);
+    runner.Resume();
+    runner.Advance(stepSize * 3.0f);
+
+    const FrameSnapshot& snapshot = runner.AcquireSnapshot();
+    Expect(runner.HasEnded() && !runner.IsActive(), "A tick that ends the level should park the runner");
+    Expect(snapshot.tick == 1, "No ticks should run after the level ends");
+    Expect(snapshot.status == World::LEVEL_COMPLETE, "The final snapshot should carry the world status");
+
+    runner.Pause();
+    Expect(!runner.HasEnded(), "Pause should clear the ended flag");
+}
+
+void TestTileEditsRepeatUntilAcknowledged() {
+    World world;
+    MakeWorld(world);
+    int wallX = -1;
+    int wallY = -1;
+    for (int y = 0; y < world.GetMapHeight() && wallX < 0; y++) {
+        for (int x = 0; x < world.GetMapWidth(); x++) {
+            if (world.GetTile(x, y) == 3) {
+                wallX = x;
+                wallY = y;
+                break;
+            }
+        }
+    }
+    Expect(wallX >= 0, "Generated map should contain a breakable wall");
+    if (wallX < 0) {
+        return;
+    }
+
+    SimRunner runner(world);
+    runner.SetTickRate(tickRate);
+    runner.Resume();
+    int tileSize = world.GetTileSize();
+    // inline mode, so the test thread is the sim thread here
+    world.DamageTileAtWorld(wallX * tileSize + tileSize * 0.5f, wallY * tileSize + tileSize * 0.5f, 1000);
+    runner.Advance(stepSize);
+    runner.Advance(stepSize);
+
+    const FrameSnapshot& snapshot = runner.AcquireSnapshot();
+    Expect(snapshot.tileEdits.size() == 1, "An unacknowledged edit should stay in later snapshots");
+    if (snapshot.tileEdits.size() == 1) {
+        const FrameSnapshot::TileEdit& edit = snapshot.tileEdits[0];
+        Expect(edit.x == wallX && edit.y == wallY && edit.type == 0, "The edit should carry the tile's new state");
+        runner.AcknowledgeTileEdits(edit.serial);
+    }
+    runner.Advance(stepSize);
+    Expect(runner.AcquireSnapshot().tileEdits.empty(), "Acknowledged edits should be dropped");
+}
+
+void TestThreadedPauseHoldsTheWorld() {
+    World world;
+    MakeWorld(world);
+    SimRunner runner(world);
+    runner.SetTickRate(240.0f);
+    runner.StartThread();
+    runner.Resume();
+    InputFrame input;
+    input.moveX = 1.0f;
+    runner.SetLiveInput(input);
+
+    Expect(WaitFor([&]() { return runner.AcquireSnapshot().tick >= 5; }), "The sim thread should tick on its own");
+    runner.Pause();
+    std::uint64_t hash = world.ComputeStateHash();
+    float playerX = world.GetPlayer().x;
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    Expect(world.ComputeStateHash() == hash, "A paused runner should leave the world alone");
+    Expect(runner.AcquireSnapshot().player.x == playerX, "The last snapshot should match the paused world");
+    runner.StopThread();
+}
+
+InputLog MakeSession() {
+    InputLog::Header header;
+    header.seed = 99;
+    header.mapWidth = 24;
+    header.mapHeight = 24;
+    header.spawnX = 400.0f;
+    header.spawnY = 300.0f;
+    header.stepSize = 1.0f / 240.0f;
+    header.difficultyMultiplier = 1.0f;
+
+    InputLog log;
+    log.Begin(header);
+    for (int i = 0; i < 240; i++) {
+        InputFrame input;
+        input.moveX = (i / 60) % 2 == 0 ? 1.0f : -1.0f;
+        input.moveY = (i / 40) % 2 == 0 ? 0.5f : -0.5f;
+        input.aimX = 400.0f + (float)(i % 200);
+        input.aimY = 100.0f + (float)(i % 50);
+        input.firePressed = (i % 3) == 0;
+        input.meleePressed = (i % 50) == 0;
+        log.AddTick(input);
+    }
+    return log;
+}
+
+void TestThreadedReplayMatchesHeadless() {
+    InputLog log = MakeSession();
+    World headless;
+    log.RunHeadless(headless);
+
+    World world;
+    log.PrepareWorld(world);
+    SimRunner runner(world);
+    runner.SetStepSize(log.GetHeader().stepSize);
+    int cursor = 0;
+    runner.SetInputSource([&](InputFrame& input) {
+        if (cursor >= log.GetEntryCount()) {
+            return false;
+        }
+        input = log.GetEntry(cursor++).input;
+        return true;
+    });
+    runner.StartThread();
+    runner.Resume();
+
+    Expect(WaitFor([&]() { return runner.HasEnded(); }), "The runner should park once the log runs out");
+    const FrameSnapshot& snapshot = runner.AcquireSnapshot();
+    Expect(snapshot.inputEnded, "The final snapshot should say the input ran out");
+    runner.Pause();
+    Expect(cursor == log.GetEntryCount(), "Every logged tick should be played");
+    Expect(world.ComputeStateHash() == headless.ComputeStateHash(),
+           "Ticking on the sim thread should end in the same state as a headless run");
+    runner.StopThread();
+}
+}
+
+int main() {
+    TestTripleBufferHandsOverWholeValues();
+    TestAdvanceRunsFixedTicksAndPublishes();
+    TestLiveInputEdgesReachOneTick();
+    TestRunnerParksWhenTheLevelEnds();
+    TestTileEditsRepeatUntilAcknowledged();
+    TestThreadedPauseHoldsTheWorld();
+    TestThreadedReplayMatchesHeadless();
+    if (failures == 0) {
+        std::cout << "All sim runner tests passed." << std::endl;
+        return 0;
+    }
+
+    std::cerr << failures << " test(s) failed." << std::endl;
+    return 1;
+}
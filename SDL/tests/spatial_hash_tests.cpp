@@ -0,0 +1,94 @@
+#include "SpatialHash.h"
+#include "CombatSystem.h"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace {
+int failures = 0;
+
+void Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << std::endl;
+        failures++;
+    }
+}
+
+bool Contains(const std::vector<int>& ids, int id) {
+    return std::find(ids.begin(), ids.end(), id) != ids.end();
+}
+
+void TestQueryFindsOverlappingCells() {
+    SpatialHash grid(50.0f);
+    grid.Clear();
+    grid.Insert(0, Entity{10.0f, 10.0f, 20.0f, 20.0f});
+    grid.Insert(1, Entity{500.0f, 500.0f, 20.0f, 20.0f});
+    grid.Build();
+
+    std::vector<int> found;
+    grid.Query(Entity{0.0f, 0.0f, 40.0f, 40.0f}, found);
+    Expect(Contains(found, 0), "Query should return the item in the same cell");
+    Expect(!Contains(found, 1), "Query should skip items in far away cells");
+}
+
+void TestItemSpanningCellsIsReportedOnce() {
+    SpatialHash grid(50.0f);
+    grid.Clear();
+    grid.Insert(7, Entity{40.0f, 40.0f, 30.0f, 30.0f}); // covers four cells
+    grid.Build();
+
+    std::vector<int> found;
+    grid.Query(Entity{0.0f, 0.0f, 100.0f, 100.0f}, found);
+    Expect(found.size() == 1 && found[0] == 7, "Multi-cell item should only be returned once per query");
+}
+
+void TestNegativeCoordinates() {
+    SpatialHash grid(50.0f);
+    grid.Clear();
+    grid.Insert(3, Entity{-80.0f, -80.0f, 10.0f, 10.0f});
+    grid.Build();
+
+    std::vector<int> found;
+    grid.Query(Entity{-75.0f, -75.0f, 2.0f, 2.0f}, found);
+    Expect(Contains(found, 3), "Grid should handle positions left of and above the origin");
+}
+
+void TestQueryBeforeBuildIsEmpty() {
+    SpatialHash grid(50.0f);
+    grid.Insert(0, Entity{0.0f, 0.0f, 10.0f, 10.0f});
+
+    std::vector<int> found;
+    grid.Query(Entity{0.0f, 0.0f, 10.0f, 10.0f}, found);
+    Expect(found.empty(), "Unbuilt grid should not return anything");
+}
+
+void TestEnemyGridSkipsDeadEnemies() {
+    std::vector<Enemy> enemies;
+    enemies.emplace_back(100.0f, 100.0f, Enemy::horizontalEnemy, 1, 1.0f);
+    enemies.emplace_back(100.0f, 100.0f, Enemy::horizontalEnemy, 1, 1.0f);
+    enemies[0].TakeDamage(enemies[0].GetHP());
+
+    SpatialHash grid;
+    CombatSystem::BuildEnemyGrid(grid, enemies);
+    std::vector<int> found;
+    grid.Query(enemies[1].getBody(), found);
+    Expect(grid.GetItemCount() == 1, "Dead enemies should not be indexed");
+    Expect(found.size() == 1 && found[0] == 1, "Grid ids should be indices into the enemy vector");
+}
+}
+
+int main() {
+    TestQueryFindsOverlappingCells();
+    TestItemSpanningCellsIsReportedOnce();
+    TestNegativeCoordinates();
+    TestQueryBeforeBuildIsEmpty();
+    TestEnemyGridSkipsDeadEnemies();
+    if (failures == 0) {
+        std::cout << "All spatial hash tests passed." << std::endl;
+        return 0;
+    }
+
+    std::cerr << failures << " test(s) failed." << std::endl;
+    return 1;
+}
@@ -0,0 +1,111 @@
+#include "SpawnSystem.h"
+#include "World.h"
+
+#include <cmath>
+#include <iostream>
+#include <set>
+
+namespace {
+int failures = 0;
+
+void Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << std::endl;
+        failures++;
+    }
+}
+
+TileMap MakeOpenMap(int size) {
+    TileMap map(size, size);
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            bool border = x == 0 || y == 0 || x == size - 1 || y == size - 1;
+            map.SetTile(x, y, border ? 1 : 0, 0);
+        }
+    }
+    return map;
+}
+
+void TestPlacementsDoNotOverlap() {
+    TileMap map = MakeOpenMap(12); // 100 free tiles
+    FreeTileIndex freeTiles;
+    freeTiles.Build(map);
+    Entity player;
+    player.x = 300.0f;
+    player.y = 300.0f;
+    Rng rng(5, 0);
+
+    std::vector<SpawnSystem::Placement> placements;
+    SpawnSystem::PlaceEntities({
+        {SpawnSystem::ENEMY, 40, 200.0f},
+        {SpawnSystem::HEALTH_ITEM, 10, 100.0f},
+        {SpawnSystem::SPEED_ITEM, 10, 100.0f},
+        {SpawnSystem::WEAPON_ITEM, 10, 100.0f},
+    }, player, freeTiles, 50, rng, placements);
+
+    Expect(placements.size() == 70, "Every request should be placed when there is room");
+    std::set<int> tiles;
+    bool farEnough = true;
+    for (const SpawnSystem::Placement& placement : placements) {
+        tiles.insert((int)placement.y / 50 * 12 + (int)placement.x / 50);
+        float dx = placement.x - player.x;
+        float dy = placement.y - player.y;
+        float minDistance = placement.kind == SpawnSystem::ENEMY ? 200.0f : 100.0f;
+        farEnough = farEnough && std::sqrt(dx * dx + dy * dy) >= minDistance;
+    }
+    Expect(tiles.size() == placements.size(), "No two placements should share a tile");
+    Expect(farEnough, "Each kind should keep its distance from the player");
+    Expect(placements[0].kind == SpawnSystem::ENEMY && placements[69].kind == SpawnSystem::WEAPON_ITEM, "Placements should come back in request order");
+    Expect(freeTiles.GetCount() == 100, "The batch should give its tiles back to the index");
+}
+
+void TestFullMapComesUpShort() {
+    TileMap map = MakeOpenMap(5); // 9 free tiles
+    FreeTileIndex freeTiles;
+    freeTiles.Build(map);
+    Entity player;
+    player.x = 0.0f;
+    player.y = 0.0f;
+    Rng rng(9, 0);
+
+    std::vector<SpawnSystem::Placement> placements;
+    SpawnSystem::PlaceEntities({
+        {SpawnSystem::ENEMY, 6, 0.0f},
+        {SpawnSystem::HEALTH_ITEM, 6, 0.0f},
+    }, player, freeTiles, 50, rng, placements);
+
+    int health = 0;
+    for (const SpawnSystem::Placement& placement : placements) {
+        health += placement.kind == SpawnSystem::HEALTH_ITEM ? 1 : 0;
+    }
+    Expect(placements.size() == 9, "A full map should stop at its free tile count instead of looping");
+    Expect(health == 3, "Later kinds should get whatever tiles are left");
+}
+
+void TestLevelStartMaterializesPlacements() {
+    World world(24, 24);
+    world.GenerateMap(400.0f, 300.0f);
+    world.Restart(1.0f);
+    Expect(world.GetEnemies().Size() == 5, "Restart should place five enemies");
+    Expect(world.GetHealthItems().size() == 2, "Restart should place two health items");
+    Expect(world.GetSpeedItems().size() == 1 && world.GetWeaponItems().size() == 1, "Restart should place one speed and one weapon item");
+    Expect(world.GetWeaponItems()[0].type == Weapon::MACHINEGUN, "Level 1 should offer the machine gun");
+
+    world.StartNextLevel(1.0f);
+    Expect(world.GetWeaponItems().size() == 1 && world.GetWeaponItems()[0].type == Weapon::RIFLE, "Level 2 should offer the rifle");
+    Expect(world.GetEnemies().Size() == 7, "Level 2 should place seven enemies");
+}
+}
+
+int main() {
+    TestPlacementsDoNotOverlap();
+    TestFullMapComesUpShort();
+    TestLevelStartMaterializesPlacements();
+    if (failures == 0) {
+        std::cout << "All spawn system tests passed." << std::endl;
+        return 0;
+    }
+
+    std::cerr << failures << " test(s) failed." << std::endl;
+    return 1;
+}
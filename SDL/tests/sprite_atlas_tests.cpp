@@ -0,0 +1,67 @@
+#include "SpriteAtlas.h"
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace {
+int failures = 0;
+
+void Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << std::endl;
+        failures++;
+    }
+}
+
+bool Overlaps(const SDL_Rect& a, const SDL_Rect& b) {
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+void TestPackKeepsRectsApartAndInBounds() {
+    std::vector<SDL_Point> sizes = {{32, 32}, {16, 21}, {32, 32}, {4, 4}, {25, 25}, {32, 32}, {16, 21}};
+    std::vector<SDL_Rect> placed;
+    int height = SpriteAtlas::Pack(sizes, 64, 1, placed);
+
+    Expect(placed.size() == sizes.size(), "Pack should place every size");
+    for (size_t i = 0; i < placed.size(); i++) {
+        Expect(placed[i].w == sizes[i].x && placed[i].h == sizes[i].y, "Placed rect should keep its size");
+        Expect(placed[i].x >= 0 && placed[i].x + placed[i].w <= 64, "Placed rect should fit the atlas width");
+        Expect(placed[i].y >= 0 && placed[i].y + placed[i].h <= height, "Placed rect should fit the returned height");
+        for (size_t j = i + 1; j < placed.size(); j++) {
+            SDL_Rect padded = {placed[j].x - 1, placed[j].y - 1, placed[j].w + 2, placed[j].h + 2};
+            Expect(!Overlaps(placed[i], padded), "Placed rects should keep the padding between them");
+        }
+    }
+}
+
+void TestPackSkipsEmptySizes() {
+    std::vector<SDL_Point> sizes = {{0, 0}, {32, 32}};
+    std::vector<SDL_Rect> placed;
+    int height = SpriteAtlas::Pack(sizes, 256, 1, placed);
+
+    Expect(placed[0].w == 0 && placed[0].h == 0, "Missing sprites should get an empty rect");
+    Expect(placed[1].x == 0 && placed[1].y == 0, "The first real sprite should start at the origin");
+    Expect(height == 32, "Height should only count placed sprites");
+}
+
+void TestEverySpriteHasAPath() {
+    for (int i = 0; i < SPRITE_COUNT; i++) {
+        const char* path = SpriteAtlas::GetPath((SpriteId)i);
+        Expect(path != nullptr && std::strncmp(path, "sprites/", 8) == 0, "Every sprite id should map to a file under sprites/");
+    }
+}
+}
+
+int main() {
+    TestPackKeepsRectsApartAndInBounds();
+    TestPackSkipsEmptySizes();
+    TestEverySpriteHasAPath();
+    if (failures == 0) {
+        std::cout << "All sprite atlas tests passed." << std::endl;
+        return 0;
+    }
+
+    std::cerr << failures << " test(s) failed." << std::endl;
+    return 1;
+}
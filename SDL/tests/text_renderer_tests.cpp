@@ -0,0 +1,89 @@
+#include "TextRenderer.h"
+
+#include <iostream>
+#include <vector>
+
+namespace {
+int failures = 0;
+
+void Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << std::endl;
+        failures++;
+    }
+}
+
+bool Overlaps(const SDL_Rect& a, const SDL_Rect& b) {
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+void TestGlyphIndexFallsBackToQuestionMark() {
+    Expect(TextRenderer::GlyphIndex(' ') == 0, "Space should be the first glyph");
+    Expect(TextRenderer::GlyphIndex('~') == TextRenderer::glyphCount - 1, "Tilde should be the last glyph");
+    Expect(TextRenderer::GlyphIndex('A') == 'A' - TextRenderer::firstGlyph, "Printable ASCII should map to its own slot");
+    int question = '?' - TextRenderer::firstGlyph;
+    Expect(TextRenderer::GlyphIndex('\t') == question, "Control characters should draw as '?'");
+    Expect(TextRenderer::GlyphIndex((char)127) == question, "DEL should draw as '?'");
+    Expect(TextRenderer::GlyphIndex((char)0xE9) == question, "Bytes past ASCII should draw as '?'");
+}
+
+void TestPackGlyphsKeepsRowsInsideTheAtlas() {
+    // more glyphs than one row holds, so the packer has to start new rows
+    std::vector<SDL_Point> sizes(TextRenderer::glyphCount, SDL_Point{12, 18});
+    sizes[5] = {0, 0};  // a glyph the font doesn't have
+    sizes[40] = {9, 24}; // a tall one
+    std::vector<SDL_Rect> placed;
+    int height = TextRenderer::PackGlyphs(sizes, placed);
+
+    Expect(placed.size() == sizes.size(), "Every glyph should get a rect");
+    Expect(placed[5].w == 0 && placed[5].h == 0, "A missing glyph should get an empty rect");
+    Expect(height > 18, "Glyphs past the first row should add to the height");
+    for (size_t i = 0; i < placed.size(); i++) {
+        if (placed[i].w == 0) {
+            continue;
+        }
+        Expect(placed[i].w == sizes[i].x && placed[i].h == sizes[i].y, "A placed glyph should keep its size");
+        Expect(placed[i].x >= 0 && placed[i].x + placed[i].w <= TextRenderer::atlasWidth, "A glyph should fit the atlas width");
+        Expect(placed[i].y >= 0 && placed[i].y + placed[i].h <= height, "A glyph should fit the returned height");
+        for (size_t j = i + 1; j < placed.size(); j++) {
+            Expect(!Overlaps(placed[i], placed[j]), "Glyphs should not overlap");
+        }
+    }
+}
+
+void TestMeasureAdvancesSumsPerGlyph() {
+    int advances[TextRenderer::glyphCount];
+    for (int i = 0; i < TextRenderer::glyphCount; i++) {
+        advances[i] = 10;
+    }
+    advances[TextRenderer::GlyphIndex('i')] = 4;
+    advances[TextRenderer::GlyphIndex('?')] = 7;
+
+    Expect(TextRenderer::MeasureAdvances("", advances) == 0, "Empty text should have no width");
+    Expect(TextRenderer::MeasureAdvances("Hi", advances) == 14, "Width should be the sum of the glyph advances");
+    Expect(TextRenderer::MeasureAdvances("a\tb", advances) == 27, "An unknown character should measure as '?'");
+}
+
+void TestUnloadedRendererMeasuresNothing() {
+    TextRenderer text;
+    int width = -1;
+    int height = -1;
+    text.MeasureCached("section        avg    p99    min  (ms) allocs", width, height);
+    Expect(!text.IsLoaded() && width == 0 && height == 0, "Without a font cached text should measure as empty");
+    text.DrawCached("anything", 0, 0, SDL_Color{255, 255, 255, 255}); // must not touch a missing renderer
+}
+}
+
+int main() {
+    TestGlyphIndexFallsBackToQuestionMark();
+    TestPackGlyphsKeepsRowsInsideTheAtlas();
+    TestMeasureAdvancesSumsPerGlyph();
+    TestUnloadedRendererMeasuresNothing();
+    if (failures == 0) {
+        std::cout << "All text renderer tests passed." << std::endl;
+        return 0;
+    }
+
+    std::cerr << failures << " test(s) failed." << std::endl;
+    return 1;
+}
@@ -0,0 +1,81 @@
+#include "TileMap.h"
+#include "World.h"
+
+#include <iostream>
+
+namespace {
+int failures = 0;
+
+void Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << std::endl;
+        failures++;
+    }
+}
+
+void TestSetAndGetAcrossChunks() {
+    TileMap map(70, 40);
+    map.SetTile(31, 31, 3, 40);
+    map.SetTile(32, 31, 2, 0);
+    map.SetTile(69, 39, 1, 0);
+
+    Expect(map.GetType(31, 31) == 3 && map.GetHP(31, 31) == 40, "Tile at the end of a chunk should keep type and HP");
+    Expect(map.GetType(32, 31) == 2, "Tile at the start of the next chunk should be separate");
+    Expect(map.GetType(69, 39) == 1, "Last tile of a partial chunk should be stored");
+    Expect(map.GetType(10, 10) == 0, "Untouched tiles should be floor");
+}
+
+void TestOutOfBoundsIsWall() {
+    TileMap map(8, 8);
+    Expect(map.GetType(-1, 0) == 1, "Left of the map should read as border wall");
+    Expect(map.GetType(8, 0) == 1, "Right of the map should read as border wall");
+    Expect(map.IsSolid(0, 8), "Below the map should be solid");
+    map.SetTile(100, 100, 2, 0); // ignored
+    Expect(map.GetType(7, 7) == 0, "Out of bounds writes should be ignored");
+}
+
+void TestBreakableWallSolidity() {
+    TileMap map(4, 4);
+    map.SetTile(1, 1, 3, 10);
+    Expect(map.IsSolid(1, 1), "Breakable wall with HP should be solid");
+    map.SetHP(1, 1, 0);
+    Expect(!map.IsSolid(1, 1), "Breakable wall without HP should not block");
+}
+
+void TestLargeMapFootprint() {
+    TileMap map(4096, 4096);
+    Expect(map.GetWidth() == 4096 && map.GetHeight() == 4096, "Map should support 4096x4096 tiles");
+    Expect(map.GetMemoryBytes() == (size_t)4096 * 4096 * 3, "Each tile should cost three bytes");
+    map.SetTile(4095, 4095, 2, 0);
+    Expect(map.IsSolid(4095, 4095), "Last tile of a large map should be addressable");
+}
+
+void TestWorldUsesRuntimeSize() {
+    World world(64, 48);
+    world.GenerateMap(400.0f, 300.0f);
+    Expect(world.GetMapWidth() == 64 && world.GetMapHeight() == 48, "World should use the requested map size");
+    Expect(world.GetTile(63, 20) == 1 && world.GetTile(20, 47) == 1, "Border should follow the map edge");
+    Expect(world.GetTile(8, 6) == 0, "Spawn area should be clear");
+
+    world.SpawnEnemies(5, 1.0f);
+    InputFrame input;
+    input.moveX = 1.0f;
+    world.Step(0.1f, input);
+    Expect(world.GetPlayer().x > 400.0f, "Player should move on a larger map");
+}
+}
+
+int main() {
+    TestSetAndGetAcrossChunks();
+    TestOutOfBoundsIsWall();
+    TestBreakableWallSolidity();
+    TestLargeMapFootprint();
+    TestWorldUsesRuntimeSize();
+    if (failures == 0) {
+        std::cout << "All tile map tests passed." << std::endl;
+        return 0;
+    }
+
+    std::cerr << failures << " test(s) failed." << std::endl;
+    return 1;
+}
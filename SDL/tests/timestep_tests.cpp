@@ -0,0 +1,90 @@
+#include "FixedTimestep.h"
+#include "World.h"
+
+#include <cmath>
+#include <iostream>
+
+namespace {
+int failures = 0;
+
+void Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << std::endl;
+        failures++;
+    }
+}
+
+void ExpectNear(float actual, float expected, float tolerance, const char* message) {
+    if (std::fabs(actual - expected) > tolerance) {
+        std::cerr << "[FAIL] " << message << std::endl;
+        failures++;
+    }
+}
+
+int CountSteps(FixedTimestep& timestep) {
+    int steps = 0;
+    while (timestep.ConsumeStep()) {
+        steps++;
+    }
+    return steps;
+}
+
+void TestAccumulatesWholeSteps() {
+    FixedTimestep timestep(100.0f, 8);
+    timestep.Accumulate(0.025f);
+    Expect(CountSteps(timestep) == 2, "25ms at 100Hz should run two steps");
+    ExpectNear(timestep.GetAlpha(), 0.5f, 0.001f, "Half a step should be left over");
+
+    timestep.Accumulate(0.005f);
+    Expect(CountSteps(timestep) == 1, "Leftover time should carry into the next frame");
+}
+
+void TestShortFramesRunNoSteps() {
+    FixedTimestep timestep(60.0f, 8);
+    timestep.Accumulate(0.001f);
+    Expect(CountSteps(timestep) == 0, "A frame shorter than one tick should not step");
+}
+
+void TestLongFrameIsClamped() {
+    FixedTimestep timestep(100.0f, 4);
+    timestep.Accumulate(2.0f);
+    Expect(CountSteps(timestep) == 4, "A hitch should only catch up maxStepsPerFrame steps");
+    Expect(timestep.GetAlpha() <= 1.0f, "Alpha should never exceed one");
+}
+
+void TestTickRateChangesStepSize() {
+    FixedTimestep timestep;
+    timestep.SetTickRate(30.0f);
+    ExpectNear(timestep.GetStepSize(), 1.0f / 30.0f, 0.0001f, "Tick rate should set the step size");
+    timestep.SetTickRate(0.0f);
+    ExpectNear(timestep.GetStepSize(), 1.0f / 30.0f, 0.0001f, "Invalid tick rate should be ignored");
+}
+
+void TestWorldKeepsPreviousPlayer() {
+    World world;
+    world.GenerateMap(400.0f, 300.0f);
+    world.SpawnEnemies(1, 1.0f);
+
+    InputFrame input;
+    input.moveX = 1.0f;
+    world.Step(0.05f, input);
+    world.Step(0.05f, input);
+    ExpectNear(world.GetPreviousPlayer().x, 410.0f, 0.01f, "Previous player should hold the position before the last step");
+    ExpectNear(world.GetPlayer().x, 420.0f, 0.01f, "Current player should hold the position after the last step");
+}
+}
+
+int main() {
+    TestAccumulatesWholeSteps();
+    TestShortFramesRunNoSteps();
+    TestLongFrameIsClamped();
+    TestTickRateChangesStepSize();
+    TestWorldKeepsPreviousPlayer();
+    if (failures == 0) {
+        std::cout << "All timestep tests passed." << std::endl;
+        return 0;
+    }
+
+    std::cerr << failures << " test(s) failed." << std::endl;
+    return 1;
+}
@@ -0,0 +1,175 @@
+#include "Profiler.h"
+#include "Tracer.h"
+#include "World.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace {
+int failures = 0;
+
+void Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << std::endl;
+        failures++;
+    }
+}
+
+void TestInactiveTracerRecordsNothing() {
+    Tracer& tracer = Tracer::Get();
+    tracer.Start(8);
+    tracer.Stop();
+    tracer.AddInstant("Test.Ignored");
+    Expect(tracer.GetEventCount() == 0, "A stopped tracer should not record events");
+}
+
+void TestRingKeepsNewestEvents() {
+    Tracer& tracer = Tracer::Get();
+    tracer.Start(4);
+    for (int i = 0; i < 10; i++) {
+        tracer.AddInstant("Test.Ring", "i", i);
+    }
+    tracer.Stop();
+
+    Expect(tracer.GetEventCount() == 4, "The ring should hold at most its capacity");
+    Expect(tracer.GetDroppedCount() == 6, "Overwritten events should be counted as dropped");
+    Expect(tracer.GetEvent(0).argValue == 6, "The oldest kept event should come first");
+    Expect(tracer.GetEvent(3).argValue == 9, "The newest event should come last");
+}
+
+void TestScopeRecordsCompleteSlice() {
+    Tracer& tracer = Tracer::Get();
+    tracer.Start(16);
+    {
+        PROFILE_SCOPE("Test.Slice");
+    }
+    tracer.Stop();
+#ifdef FPS_PROFILER_ENABLED
+    Expect(tracer.GetEventCount() == 1, "PROFILE_SCOPE should record one slice while tracing");
+    if (tracer.GetEventCount() == 1) {
+        const Tracer::Event& event = tracer.GetEvent(0);
+        Expect(std::strcmp(event.name, "Test.Slice") == 0, "The slice should carry the scope's name");
+        Expect(event.phase == 'X', "Scopes should be complete events");
+        Expect(event.durationUs >= 0.0, "Slices should not have a negative duration");
+    }
+#else
+    Expect(tracer.GetEventCount() == 0, "PROFILE_SCOPE should compile away when disabled");
+#endif
+}
+
+void TestWorldMarksLevelsAndSpawns() {
+    World world;
+    Tracer& tracer = Tracer::Get();
+    tracer.Start(64);
+    world.Restart(1.0f);
+    world.StartNextLevel(1.0f);
+    tracer.Stop();
+
+    int levelStarts = 0;
+    int spawns = 0;
+    for (int i = 0; i < tracer.GetEventCount(); i++) {
+        const Tracer::Event& event = tracer.GetEvent(i);
+        if (std::strcmp(event.name, "LevelStart") == 0) {
+            levelStarts++;
+        } else if (std::strcmp(event.name, "SpawnEnemies") == 0) {
+            spawns++;
+        }
+    }
+#ifdef FPS_PROFILER_ENABLED
+    Expect(levelStarts == 2, "Restart and StartNextLevel should each mark a level start");
+    Expect(spawns == 2, "Each level should mark its enemy spawn");
+#else
+    Expect(levelStarts == 0 && spawns == 0, "TRACE_INSTANT should compile away when disabled");
+#endif
+}
+
+void TestJsonHasTraceEvents() {
+    Tracer& tracer = Tracer::Get();
+    tracer.Start(16);
+    tracer.AddInstant("Test.Json", "value", 7);
+    auto start = std::chrono::steady_clock::now();
+    tracer.AddComplete("Test.JsonSlice", start, start + std::chrono::microseconds(250));
+    tracer.Stop();
+
+    const char* path = "trace_tests.json";
+    Expect(tracer.WriteJson(path), "WriteJson should succeed for a writable path");
+
+    std::ifstream file(path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    file.close();
+    std::remove(path);
+    std::string json = contents.str();
+
+    Expect(json.rfind("{\"traceEvents\":[", 0) == 0, "The trace should be a traceEvents object");
+    Expect(json.find("\"name\":\"Test.Json\",\"cat\":\"fps\",\"ph\":\"i\"") != std::string::npos, "Instant events should be written with phase i");
+    Expect(json.find("\"args\":{\"value\":7}") != std::string::npos, "Instant arguments should be written");
+    Expect(json.find("\"dur\":250.000") != std::string::npos, "Complete events should carry their duration");
+    Expect(json.find("]") != std::string::npos && json.back() == '\n', "The trace should be closed");
+}
+
+void TestThreadsGetTheirOwnTracks() {
+    Tracer& tracer = Tracer::Get();
+    tracer.Start(16);
+    std::thread unnamed([&]() { tracer.AddInstant("Test.UnnamedThread"); });
+    unnamed.join();
+    tracer.SetThreadName("main");
+    tracer.AddInstant("Test.MainThread");
+    std::thread other([&]() {
+        tracer.SetThreadName("sim");
+        tracer.AddInstant("Test.OtherThread");
+    });
+    other.join();
+    tracer.Stop();
+
+    int mainTrack = 0;
+    int otherTrack = 0;
+    int unnamedTrack = 0;
+    for (int i = 0; i < tracer.GetEventCount(); i++) {
+        const Tracer::Event& event = tracer.GetEvent(i);
+        if (std::strcmp(event.name, "Test.MainThread") == 0) {
+            mainTrack = event.thread;
+        } else if (std::strcmp(event.name, "Test.OtherThread") == 0) {
+            otherTrack = event.thread;
+        } else if (std::strcmp(event.name, "Test.UnnamedThread") == 0) {
+            unnamedTrack = event.thread;
+        }
+    }
+    Expect(mainTrack > 0 && otherTrack > 0 && mainTrack != otherTrack, "Events from another thread should land on their own track");
+
+    const char* path = "trace_tests_threads.json";
+    Expect(tracer.WriteJson(path), "WriteJson should succeed for a writable path");
+    std::ifstream file(path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    file.close();
+    std::remove(path);
+    std::string expected = "\"tid\":" + std::to_string(otherTrack) + ",\"args\":{\"name\":\"sim\"}";
+    Expect(contents.str().find(expected) != std::string::npos, "A named thread's track should carry its name");
+    expected = "\"tid\":" + std::to_string(mainTrack) + ",\"args\":{\"name\":\"main\"}";
+    Expect(contents.str().find(expected) != std::string::npos, "The main thread should keep its name whoever recorded first");
+    expected = "\"tid\":" + std::to_string(unnamedTrack) + ",\"args\":{\"name\":\"worker\"}";
+    Expect(unnamedTrack > 0 && contents.str().find(expected) != std::string::npos, "An unnamed thread should be labeled a worker");
+}
+}
+
+int main() {
+    TestInactiveTracerRecordsNothing();
+    TestRingKeepsNewestEvents();
+    TestScopeRecordsCompleteSlice();
+    TestWorldMarksLevelsAndSpawns();
+    TestJsonHasTraceEvents();
+    TestThreadsGetTheirOwnTracks();
+    if (failures == 0) {
+        std::cout << "All trace tests passed." << std::endl;
+        return 0;
+    }
+
+    std::cerr << failures << " test(s) failed." << std::endl;
+    return 1;
+}
@@ -0,0 +1,192 @@
+#include "World.h"
+
+#include <cmath>
+#include <iostream>
+
+namespace {
+int failures = 0;
+
+void Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << std::endl;
+        failures++;
+    }
+}
+
+void ExpectNear(float actual, float expected, float tolerance, const char* message) {
+    if (std::fabs(actual - expected) > tolerance) {
+        std::cerr << "[FAIL] " << message << std::endl;
+        failures++;
+    }
+}
+
+void TestStepMovesPlayer() {
+    World world;
+    world.GenerateMap(400.0f, 300.0f);
+    world.SpawnEnemies(1, 1.0f);
+
+    InputFrame input;
+    input.moveX = 1.0f;
+    world.Step(0.1f, input);
+
+    // tiles around the spawn point are always kept clear
+    ExpectNear(world.GetPlayer().x, 420.0f, 0.01f, "Player should move 20px right at base speed in 0.1s");
+    ExpectNear(world.GetPlayer().y, 300.0f, 0.01f, "Player should not move vertically");
+}
+
+void TestLevelCompletesWithoutEnemies() {
+    World world;
+    world.GenerateMap(400.0f, 300.0f);
+
+    InputFrame input;
+    Expect(world.Step(0.016f, input) == World::LEVEL_COMPLETE, "Level should complete when no enemies are left");
+}
+
+void TestTimerRunningOutEndsGame() {
+    World world;
+    world.GenerateMap(400.0f, 300.0f);
+    world.SpawnEnemies(1, 1.0f);
+
+    InputFrame input;
+    Expect(world.Step(101.0f, input) == World::GAME_OVER, "Game should end when the level timer runs out");
+    Expect(world.GetLevelTimer() == 0.0f, "Level timer should clamp at zero");
+}
+
+void TestFiringSpawnsBullet() {
+    World world;
+    world.GenerateMap(400.0f, 300.0f);
+    world.SpawnEnemies(1, 1.0f);
+
+    InputFrame input;
+    input.firePressed = true;
+    input.aimX = 600.0f;
+    input.aimY = 325.0f;
+    world.Step(0.001f, input);
+
+    Expect(world.FiredThisStep(), "Firing with a loaded pistol should report a shot");
+    Expect(world.GetBullets().Size() == 1, "Pistol shot should add one bullet");
+    Expect(world.GetPlayerWeapons()[0].GetCurrentAmmo() == 17, "Pistol shot should consume one round");
+}
+
+void TestRestartResetsProgress() {
+    World world;
+    world.GenerateMap(400.0f, 300.0f);
+    world.SpawnEnemies(1, 1.0f);
+    world.StartNextLevel(1.0f);
+    Expect(world.GetLevel() == 2, "Next level should advance the level counter");
+    Expect(world.GetEnemies().Size() == 7, "Level 2 should replace leftovers with 5 + level enemies");
+
+    world.Restart(1.0f);
+    Expect(world.GetLevel() == 1, "Restart should go back to level 1");
+    Expect(world.GetEnemies().Size() == 5, "Restart should spawn 5 enemies");
+    Expect(world.GetScore() == 0, "Restart should reset score");
+    Expect(world.GetPlayerHP() == world.GetPlayerMaxHP(), "Restart should heal the player");
+}
+
+void TestBrokenWallsAreRecordedAsTileChanges() {
+    World world;
+    world.GenerateMap(400.0f, 300.0f);
+    int revision = world.GetMapRevision();
+
+    int wallX = -1;
+    int wallY = -1;
+    for (int y = 0; y < world.GetMapHeight() && wallX < 0; y++) {
+        for (int x = 0; x < world.GetMapWidth(); x++) {
+            if (world.GetTile(x, y) == 3) {
+                wallX = x;
+                wallY = y;
+                break;
+            }
+        }
+    }
+    Expect(wallX >= 0, "Generated map should contain a breakable wall");
+    if (wallX < 0) {
+        return;
+    }
+
+    int tileSize = world.GetTileSize();
+    float worldX = wallX * tileSize + tileSize * 0.5f;
+    float worldY = wallY * tileSize + tileSize * 0.5f;
+    world.DamageTileAtWorld(worldX, worldY, 10);
+    Expect(world.GetTileChanges().empty(), "Damaging a wall without breaking it should not record a tile change");
+
+    world.DamageTileAtWorld(worldX, worldY, 100);
+    Expect(world.GetTile(wallX, wallY) == 0, "Breaking a wall should turn it into floor");
+    Expect(world.GetTileChanges().size() == 1, "Breaking a wall should record one tile change");
+    if (!world.GetTileChanges().empty()) {
+        Expect(world.GetTileChanges()[0].x == wallX && world.GetTileChanges()[0].y == wallY,
+               "Tile change should name the broken tile");
+    }
+    Expect(world.GetMapRevision() == revision, "Patching single tiles should not bump the map revision");
+
+    world.ClearTileChanges();
+    Expect(world.GetTileChanges().empty(), "ClearTileChanges should empty the change list");
+
+    world.DamageTileAtWorld(worldX, worldY, 100);
+    world.Step(1.0f / 120.0f, InputFrame());
+    Expect(world.GetTileChanges().empty(), "A step should drop the changes from before it");
+
+    world.DamageTileAtWorld(worldX, worldY, 100);
+    world.GenerateMap(400.0f, 300.0f);
+    Expect(world.GetTileChanges().empty(), "A new map should drop pending tile changes");
+    Expect(world.GetMapRevision() != revision, "A new map should bump the map revision");
+}
+}
+
+bool SameLayout(const World& a, const World& b) {
+    for (int y = 0; y < a.GetMapHeight(); y++) {
+        for (int x = 0; x < a.GetMapWidth(); x++) {
+            if (a.GetTile(x, y) != b.GetTile(x, y)) {
+                return false;
+            }
+        }
+    }
+    if (a.GetEnemies().Size() != b.GetEnemies().Size()) {
+        return false;
+    }
+    const EnemyPool& first = a.GetEnemies();
+    const EnemyPool& second = b.GetEnemies();
+    for (int i = 0; i < first.Size(); i++) {
+        if (first.GetX(i) != second.GetX(i) || first.GetY(i) != second.GetY(i) || first.GetType(i) != second.GetType(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void TestSameSeedGivesSameRun() {
+    World first;
+    World second;
+    first.SetSeed(1234);
+    second.SetSeed(1234);
+    // the second world's map is generated twice; each GenerateMap starts over from the seed
+    second.GenerateMap(400.0f, 300.0f);
+    first.GenerateMap(400.0f, 300.0f);
+    second.GenerateMap(400.0f, 300.0f);
+    first.Restart(1.0f);
+    second.Restart(1.0f);
+    Expect(SameLayout(first, second), "The same seed should give the same map and spawns");
+
+    World other;
+    other.SetSeed(4321);
+    other.GenerateMap(400.0f, 300.0f);
+    other.Restart(1.0f);
+    Expect(!SameLayout(first, other), "A different seed should give a different run");
+}
+
+int main() {
+    TestStepMovesPlayer();
+    TestLevelCompletesWithoutEnemies();
+    TestTimerRunningOutEndsGame();
+    TestFiringSpawnsBullet();
+    TestRestartResetsProgress();
+    TestBrokenWallsAreRecordedAsTileChanges();
+    TestSameSeedGivesSameRun();
+    if (failures == 0) {
+        std::cout << "All world tests passed." << std::endl;
+        return 0;
+    }
+
+    std::cerr << failures << " test(s) failed." << std::endl;
+    return 1;
+}
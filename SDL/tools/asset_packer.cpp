@@ -0,0 +1,91 @@
+// asset_packer.cpp
+// Build step behind assets.pack: reads each FILE under ROOT and writes them
+// all into one AssetPack, named by their path relative to ROOT so the game
+// asks for them exactly as it would for loose files. With --rgba, PNGs are
+// decoded here and stored as RGBA pixels the game can use without decoding.
+
+#include "AssetPack.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+
+namespace {
+bool EndsWith(const std::string& text, const char* suffix) {
+    size_t length = std::strlen(suffix);
+    return text.size() >= length && text.compare(text.size() - length, length, suffix) == 0;
+}
+
+// Tightly packed rows (pitch width * 4), which is what AssetPack::RGBA32 promises
+bool DecodeRgba(const std::string& path, AssetPack::Source& source) {
+    SDL_Surface* loaded = IMG_Load(path.c_str());
+    if (!loaded) {
+        return false;
+    }
+    SDL_Surface* converted = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(loaded);
+    if (!converted) {
+        return false;
+    }
+    size_t rowBytes = (size_t)converted->w * 4;
+    source.format = AssetPack::RGBA32;
+    source.width = converted->w;
+    source.height = converted->h;
+    source.bytes.resize(rowBytes * converted->h);
+    for (int y = 0; y < converted->h; y++) {
+        const unsigned char* row = (const unsigned char*)converted->pixels + (size_t)y * converted->pitch;
+        std::memcpy(source.bytes.data() + y * rowBytes, row, rowBytes);
+    }
+    SDL_FreeSurface(converted);
+    return true;
+}
+}
+
+int main(int argc, char* argv[]) {
+    int first = 1;
+    bool decode = false;
+    if (argc > 1 && std::strcmp(argv[1], "--rgba") == 0) {
+        decode = true;
+        first++;
+    }
+    if (argc - first < 2) {
+        std::fprintf(stderr, "usage: asset_packer [--rgba] OUT ROOT FILE...\n");
+        return 2;
+    }
+    const char* output = argv[first];
+    std::string root = argv[first + 1];
+    if (!root.empty() && root.back() != '/') {
+        root += '/';
+    }
+
+    std::vector<AssetPack::Source> sources;
+    size_t decoded = 0;
+    for (int i = first + 2; i < argc; i++) {
+        AssetPack::Source source;
+        source.name = argv[i];
+        std::string path = root + source.name;
+        if (decode && EndsWith(source.name, ".png") && DecodeRgba(path, source)) {
+            decoded++;
+        } else {
+            std::ifstream file(path, std::ios::binary);
+            if (!file) {
+                std::fprintf(stderr, "could not read %s\n", path.c_str());
+                return 1;
+            }
+            source.bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+        sources.push_back(std::move(source));
+    }
+
+    if (!AssetPack::Write(output, std::move(sources))) {
+        std::fprintf(stderr, "could not write %s\n", output);
+        return 1;
+    }
+    std::printf("packed %d assets (%zu decoded) into %s\n", argc - first - 2, decoded, output);
+    return 0;
+}